@@ -0,0 +1,172 @@
+/*
+ * Filename:    CompactDelaunayTriangulation.hxx
+ *
+ * Description: Header file of CompactDelaunayTriangulation class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_COMPACT_DELAUNAY_TRIANGULATION_HXX
+#define DELOMATIC_COMPACT_DELAUNAY_TRIANGULATION_HXX
+
+
+#include <random>
+#include <vector>
+#include "Triangulation.hxx"
+
+
+/**
+ * @brief Randomized Incremental Delaunay Triangulation whose mesh and History DAG live in contiguous arrays.
+ *
+ * Vertices are stored as separate x and y arrays and triangles as three 32-bit vertex indices, three 32-bit neighbor
+ * codes, and three 32-bit DAG children. A neighbor code packs the index of the adjacent triangle together with the
+ * id of the shared edge inside that triangle (triangle * 4 + edgeId), therefore no Edge objects are needed.
+ * The i-th edge of a triangle goes from its i-th vertex to its (i + 1)-th vertex.
+ *
+ * When the walk is used for point location, no DAG children are stored and the slots of the replaced triangles are
+ * reused, therefore the arrays hold about 2n triangles instead of 9n.
+ *
+ * @tparam Predicates is the predicate policy, GeometricPredicates::Fast or GeometricPredicates::Filtered
+ */
+template <typename Predicates>
+class CompactDelaunayTriangulation : public Triangulation
+{
+public:
+    /**
+     * @brief Constructor of CompactDelaunayTriangulation.
+     *
+     * @param pointLocation is the point location strategy
+     * @param insertionOrder is the order in which the vertices are inserted
+     */
+    CompactDelaunayTriangulation(PointLocation pointLocation, InsertionOrder insertionOrder);
+
+    /**
+     * @brief Destructor of CompactDelaunayTriangulation.
+     */
+    ~CompactDelaunayTriangulation() override;
+
+    /**
+     * @brief Sets the input vertices of the triangulation.
+     *
+     * @param vertices are the input vertices
+     * @param numberOfThreads is the number of threads that sort, deduplicate, and shuffle the vertices
+     */
+    void setInputVertices(std::vector<Vertex>& vertices, unsigned numberOfThreads = 1) override;
+
+private:
+    /**
+     * @brief Creates bounding Triangle.
+     */
+    void createBoundingTriangle();
+
+    /**
+     * @brief Creates a triangle without neighbors and children.
+     *
+     * @param Pi is the first vertex of the triangle
+     * @param Pj is the second vertex of the triangle
+     * @param Pk is the third vertex of the triangle
+     * @return the index of the new triangle
+     */
+    TriangleIndex createTriangle(VertexIndex Pi, VertexIndex Pj, VertexIndex Pk);
+
+    /**
+     * @brief Replaces a triangle with its children. The DAG keeps it, the walk reuses its slot.
+     *
+     * @param triangle is the replaced triangle
+     * @param children are the triangles that replace it, the third one may be NO_CHILD
+     */
+    void replaceTriangle(TriangleIndex triangle, const std::array<TriangleIndex, 3>& children);
+
+    /**
+     * @brief Connects an edge of a triangle with the given neighbor, and the neighbor with the triangle.
+     *
+     * @param triangle is the triangle
+     * @param edgeId is the id of the edge of the triangle
+     * @param neighbor is the neighbor code of the adjacent triangle, or NO_NEIGHBOR
+     */
+    void setNeighbor(TriangleIndex triangle, int edgeId, TriangleIndex neighbor);
+
+    /**
+     * @brief Checks if vertex lies inside or on one of the edges of a triangle.
+     *
+     * @param triangle is the tested triangle
+     * @param vertex is the tested vertex
+     * @param orientationTests are the results of the orientation test of the triangle
+     * @return if vertex lies inside or on one of the edges of a triangle
+     */
+    bool inTriangle(TriangleIndex triangle, VertexIndex vertex, std::array<double, 3>& orientationTests) const;
+
+    /**
+     * @brief Locates a triangle that contains the given vertex by descending the History DAG.
+     *
+     * @param vertex is the given vertex based on which we locate a triangle
+     * @param orientationTests are the results of the orientation tests that are use in the inTriangle function
+     * @return the triangle that contains the given vertex
+     */
+    TriangleIndex locateTriangle(VertexIndex vertex, std::array<double, 3>& orientationTests) const;
+
+    /**
+     * @brief Locates a triangle that contains the given vertex by walking from the last created triangle.
+     * At each triangle the edges are tested starting from a random one, and the edge through which the walk entered
+     * the triangle is skipped (remembering stochastic walk).
+     *
+     * @param vertex is the given vertex based on which we locate a triangle
+     * @param orientationTests are the results of the orientation tests that are use in the inTriangle function
+     * @return the triangle that contains the given vertex
+     */
+    TriangleIndex walkToTriangle(VertexIndex vertex, std::array<double, 3>& orientationTests);
+
+    /**
+     * @brief Legalizes an edge.
+     *
+     * @param PiPjPr is the triangle whose edgeId-th edge (PiPj) will be legalized, Pr is its apex vertex
+     * @param edgeId is the id of the edge PiPj in PiPjPr
+     */
+    void legalizeEdge(TriangleIndex PiPjPr, int edgeId);
+
+    /**
+     * @brief Stores the triangles of the Delaunay Triangulation without the bounding triangle in the output mesh.
+     */
+    void createOutputMesh();
+
+public:
+    /**
+     * @brief Generates the Delaunay Mesh of the input vertices.
+     */
+    void generateMesh() override;
+
+private:
+    static constexpr VertexIndex NO_VERTEX = UINT32_MAX;
+    static constexpr TriangleIndex NO_NEIGHBOR = UINT32_MAX;
+    static constexpr TriangleIndex NO_CHILD = UINT32_MAX;
+
+    PointLocation pointLocation;
+
+    InsertionOrder insertionOrder;
+
+    //  last created triangle, where the walk starts
+    TriangleIndex lastCreatedTriangle = 0;
+
+    //  slots of replaced triangles that can be reused, only used by the walk
+    std::vector<TriangleIndex> freeTriangles;
+
+    //  chooses the first edge tested by the walk at each triangle
+    std::minstd_rand walkRandomGenerator;
+
+    //  number of input vertices; the vertices of the bounding triangle are stored after them
+    VertexIndex numberOfMeshVertices = 0;
+
+    std::vector<double> verticesX;
+    std::vector<double> verticesY;
+
+    std::vector<std::array<VertexIndex, 3>> triangleVertices;
+    std::vector<std::array<TriangleIndex, 3>> triangleNeighbors;
+
+    //  children triangles in DAG, either 0, 2, or 3 of them; unused children are set to NO_CHILD.
+    //  Only used by the DAG.
+    std::vector<std::array<TriangleIndex, 3>> triangleChildren;
+};
+
+
+#endif /* DELOMATIC_COMPACT_DELAUNAY_TRIANGULATION_HXX */
@@ -11,34 +11,42 @@
 #define DELOMATIC_DELAUNAY_TRIANGULATION
 
 
+#include <random>
 #include <vector>
-#include "Mesh.hxx"
-#include "Timer.hxx"
-#include "Edge.hxx"
+#include "MemoryPool.hxx"
 #include "HistoryDAG.hxx"
+#include "Triangulation.hxx"
 
 
-class DelaunayTriangulation : public HistoryDAG
+/**
+ * @brief Randomized Incremental Delaunay Triangulation whose vertices and triangles are objects of the memory pools.
+ *
+ * @tparam Predicates is the predicate policy, GeometricPredicates::Fast or GeometricPredicates::Filtered
+ */
+template <typename Predicates>
+class DelaunayTriangulation : public Triangulation, public HistoryDAG
 {
 public:
     /**
      * @brief Constructor of DelaunayTriangulation.
      *
-     * @param robustPredicates is a boolean value that indicates if robust predicates will be used
+     * @param pointLocation is the point location strategy
+     * @param insertionOrder is the order in which the vertices are inserted
      */
-    explicit DelaunayTriangulation(bool robustPredicates);
+    DelaunayTriangulation(PointLocation pointLocation, InsertionOrder insertionOrder);
 
     /**
      * @brief Destructor of DelaunayTriangulation.
      */
-    ~DelaunayTriangulation();
+    ~DelaunayTriangulation() override;
 
     /**
      * @brief Sets the input vertices of the triangulation.
      *
      * @param vertices are the input vertices
+     * @param numberOfThreads is the number of threads that sort, deduplicate, and shuffle the vertices
      */
-    void setInputVertices(std::vector<Vertex>& vertices);
+    void setInputVertices(std::vector<Vertex>& vertices, unsigned numberOfThreads = 1) override;
 
 private:
     /**
@@ -46,35 +54,85 @@ private:
      */
     void createBoundingTriangle();
 
+    /**
+     * @brief Creates a triangle without neighbors and children.
+     *
+     * @param Pi is the first vertex of the triangle
+     * @param Pj is the second vertex of the triangle
+     * @param Pk is the third vertex of the triangle
+     * @return the new triangle
+     */
+    TriangleHandle createTriangle(const VertexHandle& Pi, const VertexHandle& Pj, const VertexHandle& Pk);
+
+    /**
+     * @brief Replaces a triangle with its children in the DAG, if it is used, and recycles it.
+     *
+     * @param triangle is the replaced triangle
+     * @param children are the triangles that replace it, the third one may be nullptr
+     */
+    void replaceTriangle(const TriangleHandle& triangle, const std::array<TriangleHandle, 3>& children);
+
+    /**
+     * @brief Locates a triangle that contains the given vertex by walking from the last created triangle.
+     * At each triangle the edges are tested starting from a random one, and the edge through which the walk entered
+     * the triangle is skipped (remembering stochastic walk).
+     *
+     * @param vertex is the given vertex based on which we locate a triangle
+     * @param orientationTests are the results of the orientation tests that are use in the inTriangle function
+     * @return the triangle that contains the given vertex
+     */
+    TriangleHandle walkToTriangle(const VertexHandle& vertex, std::array<double, 3>& orientationTests);
+
+    /**
+     * @brief Extracts the triangles of the Delaunay Triangulation without the bounding triangle by visiting the
+     * neighbors of the last created triangle. It is used instead of the DAG when the walk is used.
+     *
+     * @return the triangles of the Delaunay Triangulation
+     */
+    std::vector<TriangleHandle> extractTriangulationFromNeighbors();
+
     /**
      * @brief Legalizes an edge.
      *
-     * @param PiPj is the edge that will be legalized
-     * @param Pr is the vertex that will be checked if it is inside PiPjPk triangle
+     * @param PiPjPr is the triangle whose edgeId-th edge (PiPj) will be legalized, Pr is its apex vertex
+     * @param edgeId is the id of the edge PiPj in PiPjPr
      */
-    static void legalizeEdge(EdgeHandle& PiPj, const VertexHandle& Pr);
+    void legalizeEdge(const TriangleHandle& PiPjPr, int edgeId);
 
-public:
     /**
-     * @brief Generates the Delaunay Mesh of the input vertices
+     * @brief Releases the History DAG, the triangulation and the vertices in bulk. The output mesh is kept.
      */
-    void generateMesh();
+    void releaseTriangulation();
 
     /**
-     * @brief Validates if the triangulation is Delaunay. Cost: O (n log n)
+     * @brief Stores the given triangles in the output mesh.
+     *
+     * @param triangles are the triangles of the Delaunay Triangulation
      */
-    void validateDelaunayTriangulation();
+    void createOutputMesh(const std::vector<TriangleHandle>& triangles);
 
+public:
     /**
-     * @brief Gets outputMesh.
+     * @brief Generates the Delaunay Mesh of the input vertices
      */
-    Mesh getOutputMesh();
+    void generateMesh() override;
 
 private:
+    PointLocation pointLocation;
+
+    InsertionOrder insertionOrder;
+
+    //  pools that own every vertex and triangle of the triangulation
+    MemoryPool<Vertex> vertexPool;
+    MemoryPool<Triangle> trianglePool;
+
+    //  last created triangle, where the walk starts
+    TriangleHandle lastCreatedTriangle = nullptr;
+
+    //  chooses the first edge tested by the walk at each triangle
+    std::minstd_rand walkRandomGenerator;
+
     std::vector<VertexHandle> meshVertices;
-    std::vector<TriangleHandle> meshTriangles;
-public:
-    Timer computeBoundaryTriangleTimer{}, meshingTimer{}, validateDelaunayTriangulationTimer{};
 };
 
 
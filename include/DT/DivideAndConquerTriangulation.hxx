@@ -0,0 +1,155 @@
+/*
+ * Filename:    DivideAndConquerTriangulation.hxx
+ *
+ * Description: Header file of DivideAndConquerTriangulation class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_DIVIDE_AND_CONQUER_TRIANGULATION_HXX
+#define DELOMATIC_DIVIDE_AND_CONQUER_TRIANGULATION_HXX
+
+
+#include <utility>
+#include <vector>
+#include "QuadEdgeMesh.hxx"
+#include "Triangulation.hxx"
+
+
+/**
+ * @brief Divide and Conquer Delaunay Triangulation of Guibas and Stolfi with the alternating cuts of Dwyer.
+ *
+ * The vertices are split recursively at their median, alternately along x and along y, and the triangulations of the
+ * two halves are merged starting from their lower common tangent. Alternating cuts keep the halves close to square,
+ * so the merges create and delete far fewer long, thin triangles than vertical cuts only.
+ *
+ * The two halves of the top levels of the recursion are triangulated by different threads; each thread creates its
+ * edges through its own QuadEdgeMesh::Allocator, and the merges of these levels happen after the threads of both
+ * halves have finished, therefore the result does not depend on the number of threads.
+ *
+ * @tparam Predicates is the predicate policy, GeometricPredicates::Fast or GeometricPredicates::Filtered
+ */
+template <typename Predicates>
+class DivideAndConquerTriangulation : public Triangulation
+{
+public:
+    /**
+     * @brief Constructor of DivideAndConquerTriangulation.
+     *
+     * @param numberOfThreads is the number of threads that triangulate the top levels of the recursion
+     */
+    explicit DivideAndConquerTriangulation(unsigned numberOfThreads);
+
+    /**
+     * @brief Destructor of DivideAndConquerTriangulation.
+     */
+    ~DivideAndConquerTriangulation() override;
+
+    /**
+     * @brief Sets the input vertices of the triangulation.
+     *
+     * @param vertices are the input vertices
+     * @param numberOfThreads is the number of threads that sort and deduplicate the vertices
+     */
+    void setInputVertices(std::vector<Vertex>& vertices, unsigned numberOfThreads = 1) override;
+
+private:
+    /**
+     * @brief Checks if three vertices make a counterclockwise turn.
+     */
+    [[nodiscard]] bool counterClockwise(VertexIndex a, VertexIndex b, VertexIndex c) const;
+
+    /**
+     * @brief Checks if a vertex lies strictly left of an edge.
+     */
+    [[nodiscard]] bool leftOf(VertexIndex vertex, EdgeIndex e) const;
+
+    /**
+     * @brief Checks if a vertex lies strictly right of an edge.
+     */
+    [[nodiscard]] bool rightOf(VertexIndex vertex, EdgeIndex e) const;
+
+    /**
+     * @brief Checks if d lies strictly inside the circumcircle of the counterclockwise triangle abc.
+     */
+    [[nodiscard]] bool inCircumcircle(VertexIndex a, VertexIndex b, VertexIndex c, VertexIndex d) const;
+
+    /**
+     * @brief Checks if a vertex precedes another one along an axis.
+     *
+     * @param a is the first vertex
+     * @param b is the second vertex
+     * @param axis is 0 for the order along x, 1 for the order along y
+     * @return if a precedes b along the axis
+     */
+    [[nodiscard]] bool precedes(VertexIndex a, VertexIndex b, int axis) const;
+
+    /**
+     * @brief Finds the counterclockwise convex hull edge out of the first vertex of a triangulation along an axis.
+     *
+     * @param ccwHullEdge is a counterclockwise convex hull edge of the triangulation
+     * @param axis is 0 for the order along x, 1 for the order along y
+     * @return the counterclockwise convex hull edge out of the first vertex
+     */
+    [[nodiscard]] EdgeIndex hullEdgeOutOfFirstVertex(EdgeIndex ccwHullEdge, int axis) const;
+
+    /**
+     * @brief Finds the clockwise convex hull edge out of the last vertex of a triangulation along an axis.
+     *
+     * @param cwHullEdge is a clockwise convex hull edge of the triangulation
+     * @param axis is 0 for the order along x, 1 for the order along y
+     * @return the clockwise convex hull edge out of the last vertex
+     */
+    [[nodiscard]] EdgeIndex hullEdgeOutOfLastVertex(EdgeIndex cwHullEdge, int axis) const;
+
+    /**
+     * @brief Triangulates the vertices [first, last), which must be at least 2. The vertices of the range are
+     * reordered, so that each half of a cut is contiguous.
+     *
+     * @param first is the first vertex
+     * @param last is one past the last vertex
+     * @param axis is 0 if the vertices are split by a vertical cut, 1 if they are split by a horizontal cut
+     * @param allocator is the allocator of the calling thread
+     * @param parallelLevels is the number of the following recursion levels whose halves use a thread each
+     * @return the counterclockwise convex hull edge out of the leftmost vertex and the clockwise convex hull edge out
+     * of the rightmost vertex
+     */
+    std::pair<EdgeIndex, EdgeIndex> triangulate(VertexIndex first, VertexIndex last, int axis,
+                                                QuadEdgeMesh::Allocator& allocator, unsigned parallelLevels);
+
+    /**
+     * @brief Merges the triangulations of the two halves of a cut.
+     *
+     * @param left are the convex hull edges of the left (or bottom) triangulation as returned by triangulate
+     * @param right are the convex hull edges of the right (or top) triangulation as returned by triangulate
+     * @param axis is 0 if the halves are separated by a vertical cut, 1 if they are separated by a horizontal cut
+     * @param allocator is the allocator of the calling thread
+     * @return the convex hull edges of the merged triangulation
+     */
+    std::pair<EdgeIndex, EdgeIndex> mergeTriangulations(std::pair<EdgeIndex, EdgeIndex> left,
+                                                        std::pair<EdgeIndex, EdgeIndex> right, int axis,
+                                                        QuadEdgeMesh::Allocator& allocator);
+
+    /**
+     * @brief Stores the faces of the quad-edge mesh in the output mesh.
+     */
+    void createOutputMesh();
+
+public:
+    /**
+     * @brief Generates the Delaunay Mesh of the input vertices.
+     */
+    void generateMesh() override;
+
+private:
+    unsigned numberOfThreads;
+
+    //  vertices; each range that is triangulated is split at its median along the axis of its cut
+    std::vector<std::array<double, 2>> meshVertices;
+
+    QuadEdgeMesh quadEdgeMesh;
+};
+
+
+#endif /* DELOMATIC_DIVIDE_AND_CONQUER_TRIANGULATION_HXX */
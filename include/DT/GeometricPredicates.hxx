@@ -11,37 +11,262 @@
 #define DELOMATIC_GEOMETRIC_PREDICATES_HXX
 
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 #include "Triangle.hxx"
 
 
+extern "C" {
+//  adaptive exact stages of the predicates of predicates.c, which do not modify their arguments
+double orient2dadapt(double* pa, double* pb, double* pc, double detsum);
+double incircleadapt(double* pa, double* pb, double* pc, double* pd, double permanent);
+}
+
 namespace GeometricPredicates
 {
     /**
-     * @brief Initializes Predicates.
+     * @brief Initializes the adaptive exact stages of the filtered predicates.
+     */
+    void initialize();
+
+    /**
+     * @brief Predicates that evaluate their determinants in floating-point arithmetic only. Their sign may be wrong
+     * for nearly degenerate inputs.
+     *
+     * The predicate policies are the template argument of the triangulation engines, so that the predicates are
+     * chosen once and inlined in the hot loops instead of being called through function pointers.
+     */
+    struct Fast
+    {
+        static constexpr bool robust = false;
+
+        /**
+         * @brief Computes the orientation of three vertices.
+         *
+         * @param pa are the coordinates of the first vertex
+         * @param pb are the coordinates of the second vertex
+         * @param pc are the coordinates of the third vertex
+         * @return a positive value if pa, pb, and pc are in counterclockwise order, a negative value if they are in
+         * clockwise order, and zero if they are collinear
+         */
+        static double orientation(const double* pa, const double* pb, const double* pc)
+        {
+            const double acx = pa[0] - pc[0];
+            const double bcx = pb[0] - pc[0];
+            const double acy = pa[1] - pc[1];
+            const double bcy = pb[1] - pc[1];
+
+            return acx * bcy - acy * bcx;
+        }
+
+        /**
+         * @brief Checks if a vertex lies inside the circumcircle of a clockwise triangle.
+         *
+         * @param pa are the coordinates of the first vertex of the triangle
+         * @param pb are the coordinates of the second vertex of the triangle
+         * @param pc are the coordinates of the third vertex of the triangle
+         * @param pd are the coordinates of the tested vertex
+         * @return a boolean value which indicates if vertex pd lies inside the circumcircle
+         */
+        static bool inCircle(const double* pa, const double* pb, const double* pc, const double* pd)
+        {
+            const double adx = pa[0] - pd[0];
+            const double ady = pa[1] - pd[1];
+            const double bdx = pb[0] - pd[0];
+            const double bdy = pb[1] - pd[1];
+            const double cdx = pc[0] - pd[0];
+            const double cdy = pc[1] - pd[1];
+
+            const double abdet = adx * bdy - bdx * ady;
+            const double bcdet = bdx * cdy - cdx * bdy;
+            const double cadet = cdx * ady - adx * cdy;
+            const double alift = adx * adx + ady * ady;
+            const double blift = bdx * bdx + bdy * bdy;
+            const double clift = cdx * cdx + cdy * cdy;
+
+            return alift * bcdet + blift * cadet + clift * abdet < 0;
+        }
+    };
+
+    /**
+     * @brief Numbers of evaluations of the filtered predicates, and of the ones that the filter could not decide.
+     */
+    struct FilterStatistics
+    {
+        uint64_t orientationTests = 0;
+        uint64_t orientationFallbacks = 0;
+        uint64_t inCircleTests = 0;
+        uint64_t inCircleFallbacks = 0;
+    };
+
+    /**
+     * @brief Adds the statistics of the calling thread to the totals of the process and resets them. A worker thread
+     * that evaluates the filtered predicates calls it before it exits, otherwise its statistics are lost.
+     */
+    void flushFilterStatistics();
+
+    /**
+     * @brief Gets the statistics that the threads have flushed and the statistics of the calling thread.
+     *
+     * @return the statistics of the filtered predicates
+     */
+    FilterStatistics getFilterStatistics();
+
+    //  statistics of the calling thread. They are trivially destructible, therefore they are constant-initialized and
+    //  the predicates access them directly, without a call to the initialization function of the thread storage.
+    static_assert(std::is_trivially_destructible_v<FilterStatistics>);
+    inline thread_local FilterStatistics threadFilterStatistics;
+
+    /**
+     * @brief Predicates that return the exact sign of their determinants.
      *
-     * @param robustPredicates is a boolean value which indicates if the robust predicates are requested
+     * The floating-point determinant is computed inline together with a bound of its rounding error, which is
+     * proportional to the magnitude of its terms (the first stage of the predicates of Shewchuk). Only when the
+     * determinant is smaller than the bound, its sign is uncertain and the adaptive exact stages of predicates.c
+     * are called.
      */
-    void initialize(bool robustPredicates);
+    struct Filtered
+    {
+        static constexpr bool robust = true;
+
+        //  the largest power of two such that 1 + epsilon == 1 in floating-point arithmetic
+        static constexpr double EPSILON = std::numeric_limits<double>::epsilon() / 2;
+        static constexpr double ORIENTATION_ERROR_BOUND = (3.0 + 16.0 * EPSILON) * EPSILON;
+        static constexpr double IN_CIRCLE_ERROR_BOUND = (10.0 + 96.0 * EPSILON) * EPSILON;
+
+        /**
+         * @brief Computes the orientation of three vertices.
+         *
+         * @param pa are the coordinates of the first vertex
+         * @param pb are the coordinates of the second vertex
+         * @param pc are the coordinates of the third vertex
+         * @return a positive value if pa, pb, and pc are in counterclockwise order, a negative value if they are in
+         * clockwise order, and zero if they are collinear
+         */
+        static double orientation(const double* pa, const double* pb, const double* pc)
+        {
+            ++threadFilterStatistics.orientationTests;
+
+            const double detLeft = (pa[0] - pc[0]) * (pb[1] - pc[1]);
+            const double detRight = (pa[1] - pc[1]) * (pb[0] - pc[0]);
+            const double det = detLeft - detRight;
+
+            //  the rounding error of det is bounded by the sum of the magnitudes of the two products
+            const double detSum = std::fabs(detLeft) + std::fabs(detRight);
+            if (std::fabs(det) >= ORIENTATION_ERROR_BOUND * detSum) {
+                return det;
+            }
+
+            ++threadFilterStatistics.orientationFallbacks;
+            return orient2dadapt(const_cast<double*>(pa), const_cast<double*>(pb), const_cast<double*>(pc), detSum);
+        }
+
+        /**
+         * @brief Checks if a vertex lies inside the circumcircle of a clockwise triangle.
+         *
+         * @param pa are the coordinates of the first vertex of the triangle
+         * @param pb are the coordinates of the second vertex of the triangle
+         * @param pc are the coordinates of the third vertex of the triangle
+         * @param pd are the coordinates of the tested vertex
+         * @return a boolean value which indicates if vertex pd lies inside the circumcircle
+         */
+        static bool inCircle(const double* pa, const double* pb, const double* pc, const double* pd)
+        {
+            ++threadFilterStatistics.inCircleTests;
+
+            const double adx = pa[0] - pd[0];
+            const double ady = pa[1] - pd[1];
+            const double bdx = pb[0] - pd[0];
+            const double bdy = pb[1] - pd[1];
+            const double cdx = pc[0] - pd[0];
+            const double cdy = pc[1] - pd[1];
+
+            const double bdxcdy = bdx * cdy;
+            const double cdxbdy = cdx * bdy;
+            const double alift = adx * adx + ady * ady;
+
+            const double cdxady = cdx * ady;
+            const double adxcdy = adx * cdy;
+            const double blift = bdx * bdx + bdy * bdy;
+
+            const double adxbdy = adx * bdy;
+            const double bdxady = bdx * ady;
+            const double clift = cdx * cdx + cdy * cdy;
+
+            const double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+
+            const double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * alift +
+                                     (std::fabs(cdxady) + std::fabs(adxcdy)) * blift +
+                                     (std::fabs(adxbdy) + std::fabs(bdxady)) * clift;
+            if (std::fabs(det) > IN_CIRCLE_ERROR_BOUND * permanent) {
+                return det < 0;
+            }
+
+            ++threadFilterStatistics.inCircleFallbacks;
+            return incircleadapt(const_cast<double*>(pa), const_cast<double*>(pb), const_cast<double*>(pc),
+                                 const_cast<double*>(pd), permanent) < 0;
+        }
+    };
+
+    /**
+     * @brief Checks if vertex lies inside or on one of the edges of a triangle.
+     *
+     * @tparam Predicates is the predicate policy
+     * @param pa are the coordinates of the first vertex of the triangle
+     * @param pb are the coordinates of the second vertex of the triangle
+     * @param pc are the coordinates of the third vertex of the triangle
+     * @param pd are the coordinates of the tested vertex
+     * @param orientationTests are the results of the orientation test of the triangle
+     * @return if vertex lies inside or on one of the edges of a triangle
+     */
+    template <typename Predicates>
+    inline bool inTriangle(const double* pa, const double* pb, const double* pc, const double* pd,
+                           std::array<double, 3>& orientationTests)
+    {
+        orientationTests[0] = Predicates::orientation(pa, pb, pd);
+        orientationTests[1] = Predicates::orientation(pb, pc, pd);
+        orientationTests[2] = Predicates::orientation(pc, pa, pd);
+
+        return orientationTests[0] <= 0 && orientationTests[1] <= 0 && orientationTests[2] <= 0;
+    }
 
     /**
      * @brief Checks if a vertex lies inside the circumcircle of a triangle
      *
+     * @tparam Predicates is the predicate policy
      * @param triangle is the triangle
      * @param vertex is the vertex
      * @return a boolean value which indicates if vertex d lies inside the circumcircle
      */
-    bool inCircle(const TriangleHandle& triangle, const VertexHandle& vertex);
+    template <typename Predicates>
+    inline bool inCircle(const TriangleHandle& triangle, const VertexHandle& vertex)
+    {
+        return Predicates::inCircle(triangle->vertices[0]->coordinates,
+                                    triangle->vertices[1]->coordinates,
+                                    triangle->vertices[2]->coordinates,
+                                    vertex->coordinates);
+    }
 
     /**
      * @brief Checks if vertex lies inside or on one of the edges of a triangle.
      *
+     * @tparam Predicates is the predicate policy
      * @param triangle is the tested triangle
      * @param vertex is the tested vertex
      * @param orientationTests are the results of the orientation test of the triangle
      * @return if vertex lies inside or on one of the edges of a triangle
      */
-    bool
-    inTriangle(const TriangleHandle& triangle, const VertexHandle& vertex, std::array<double, 3>& orientationTests);
+    template <typename Predicates>
+    inline bool
+    inTriangle(const TriangleHandle& triangle, const VertexHandle& vertex, std::array<double, 3>& orientationTests)
+    {
+        return inTriangle<Predicates>(triangle->vertices[0]->coordinates,
+                                      triangle->vertices[1]->coordinates,
+                                      triangle->vertices[2]->coordinates,
+                                      vertex->coordinates, orientationTests);
+    }
 }
 
 
@@ -11,10 +11,19 @@
 #define DELOMATIC_HISTORY_DAG_HXX
 
 
-#include "Edge.hxx"
+#include <cstdint>
+#include <vector>
 #include "GeometricPredicates.hxx"
 
 
+/**
+ * @brief History DAG of the incremental Delaunay Triangulation, stored as a flat array of nodes.
+ *
+ * Each node holds the coordinates of its triangle inline and the indices of its children, so a descent reads one
+ * node per level instead of a triangle and its three vertices. The children of a node are created together,
+ * therefore they are adjacent in the array. Only the leaves keep their triangle, so the replaced triangles can be
+ * recycled by the triangulation.
+ */
 class HistoryDAG
 {
 public:
@@ -29,61 +38,69 @@ public:
     ~HistoryDAG();
 
     /**
-     * @brief Sets the root triangle of the DAG.
+     * @brief Reserves the nodes of the DAG of a triangulation, so that they are never moved.
      *
-     * @param triangle is the triangle that will be set as the root
+     * @param numberOfVertices is the number of vertices of the triangulation
      */
-    void setRootTriangle(TriangleHandle& triangle);
+    void reserve(size_t numberOfVertices);
 
-private:
     /**
-     * @brief Locates a triangle that contains the given vertex.
-     * @note: this function is a helper of the public locateTriangle function.
+     * @brief Adds a triangle as a leaf of the DAG. The first added triangle is the root, which must be the bounding
+     * triangle.
      *
-     * @param triangle is the triangle whose children are checked in the recursion
-     * @param vertex is the given vertex based on which we locate a triangle
-     * @param orientationTests are the results of the orientation tests that are use in the inTriangle function
-     * @return the triangle that contains the given vertex
+     * @param triangle is the added triangle
+     * @return the index of the node of the triangle
      */
-    static TriangleHandle& locateTriangle(TriangleHandle& triangle, VertexHandle vertex,
-                                          std::array<double, 3>& orientationTests);
+    uint32_t addTriangle(const TriangleHandle& triangle);
 
     /**
-     * @brief Checks if a triangle contains the vertices of the root triangle.
+     * @brief Sets the children of the node of a triangle that is replaced. The triangle is no longer referenced.
      *
-     * @param triangle is the triangle that is checked
-     * @return a boolean value which indicates if a triangle contains the vertices of the root triangle
+     * @param triangle is the replaced triangle
+     * @param children are the triangles that replace it, the third one may be nullptr
      */
-    [[nodiscard]] bool containsBoundingTriangleVertices(TriangleHandle triangle) const;
+    void addChildTriangles(const TriangleHandle& triangle, const std::array<TriangleHandle, 3>& children);
 
     /**
-     * @brief Extracts the triangles of the Delaunay Triangulation without the bounding triangle.
-     * @note: this is a helper function of the public extractTriangulationWithoutBoundingTriangle function.
-     *
-     * @param triangles is a vector that includes the triangles of the Delaunay Triangulation
-     * @param triangle is the triangle whose children are checked in the recursion
+     * @brief Releases the nodes of the DAG. The triangles are owned and released by its user.
      */
-    void extractTriangulationWithoutBoundingTriangle(std::vector<TriangleHandle>& triangles, TriangleHandle& triangle);
+    void clear();
 
-public:
     /**
      * @brief Locates a triangle that contains the given vertex.
      *
+     * @tparam Predicates is the predicate policy
      * @param vertex is the given vertex based on which we locate a triangle
      * @param orientationTests are the results of the orientation tests that are use in the inTriangle function
      * @return the triangle that contains the given vertex
      */
-    TriangleHandle& locateTriangle(VertexHandle vertex, std::array<double, 3>& orientationTests);
+    template <typename Predicates>
+    TriangleHandle locateTriangle(VertexHandle vertex, std::array<double, 3>& orientationTests) const;
 
     /**
      * @brief Extracts the triangles of the Delaunay Triangulation without the bounding triangle.
      *
      * @return the triangles of the Delaunay Triangulation
      */
-    std::vector<TriangleHandle> extractTriangulationWithoutBoundingTriangle();
+    [[nodiscard]] std::vector<TriangleHandle> extractTriangulationWithoutBoundingTriangle() const;
 
 private:
-    TriangleHandle rootTriangle;
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+    //  a node fills a cache line: the coordinates of the three vertices of its triangle and up to three children
+    struct alignas(64) Node
+    {
+        std::array<double, 6> coordinates;
+        std::array<uint32_t, 3> children;
+        uint32_t numberOfChildren;
+    };
+
+    std::vector<Node> nodes;
+
+    //  the triangle of each leaf node, nullptr for the inner nodes
+    std::vector<TriangleHandle> leafTriangles;
+
+    std::array<VertexHandle, 3> boundingVertices;
 };
 
 
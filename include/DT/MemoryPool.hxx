@@ -0,0 +1,135 @@
+/*
+ * Filename:    MemoryPool.hxx
+ *
+ * Description: Header file of MemoryPool class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_MEMORY_POOL_HXX
+#define DELOMATIC_MEMORY_POOL_HXX
+
+
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+
+/**
+ * @brief Typed slab allocator that hands out objects of type T from large chunks.
+ *
+ * Objects are never returned to the system one by one; all chunks are released at once by release() or by the
+ * destructor. Objects that are no longer needed can be recycled, so that their slots are reused by later create()
+ * calls. A recycled object stays constructed until its slot is reused or the pool is released, therefore every slot
+ * of every chunk always holds a constructed object and the bulk release can destroy them without bookkeeping.
+ *
+ * @tparam T is the type of the pooled objects
+ * @tparam ChunkSize is the number of objects per chunk
+ */
+template<typename T, size_t ChunkSize = 4096>
+class MemoryPool
+{
+public:
+    /**
+     * @brief Constructor of MemoryPool.
+     */
+    MemoryPool() = default;
+
+    MemoryPool(const MemoryPool&) = delete;
+
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    /**
+     * @brief Destructor of MemoryPool. Destroys all the objects and releases all the chunks.
+     */
+    ~MemoryPool()
+    {
+        release();
+    }
+
+    /**
+     * @brief Creates an object, reusing a recycled slot if one exists.
+     *
+     * @param args are the arguments passed to the constructor of T
+     * @return the created object
+     */
+    template<typename... Args>
+    T* create(Args&& ... args)
+    {
+        T* object;
+        if (!recycledObjects.empty()) {
+            object = recycledObjects.back();
+            recycledObjects.pop_back();
+            object->~T();
+        } else {
+            if (chunks.empty() || usedInLastChunk == ChunkSize) {
+                chunks.push_back(allocator.allocate(ChunkSize));
+                usedInLastChunk = 0;
+            }
+            object = chunks.back() + usedInLastChunk++;
+        }
+        return new(object) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns an object to the pool so that its slot can be reused.
+     *
+     * @param object is the object that is no longer used
+     */
+    void recycle(T* object)
+    {
+        recycledObjects.push_back(object);
+    }
+
+    /**
+     * @brief Destroys all the objects and releases all the chunks. Cost: O(number of chunks) for trivially
+     * destructible types, O(number of objects) otherwise.
+     */
+    void release()
+    {
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            size_t constructedObjects = i + 1 == chunks.size() ? usedInLastChunk : ChunkSize;
+            std::destroy_n(chunks[i], constructedObjects);
+            allocator.deallocate(chunks[i], ChunkSize);
+        }
+        chunks.clear();
+        chunks.shrink_to_fit();
+        recycledObjects.clear();
+        recycledObjects.shrink_to_fit();
+        usedInLastChunk = 0;
+    }
+
+    /**
+     * @brief Gets the number of objects that are in use.
+     *
+     * @return the number of objects that are in use
+     */
+    [[nodiscard]] size_t size() const
+    {
+        return capacity() - (ChunkSize - usedInLastChunk) * !chunks.empty() - recycledObjects.size();
+    }
+
+    /**
+     * @brief Gets the number of slots that have been allocated.
+     *
+     * @return the number of slots that have been allocated
+     */
+    [[nodiscard]] size_t capacity() const
+    {
+        return chunks.size() * ChunkSize;
+    }
+
+private:
+    std::allocator<T> allocator;
+
+    std::vector<T*> chunks;
+
+    size_t usedInLastChunk = 0;
+
+    std::vector<T*> recycledObjects;
+};
+
+
+#endif /* DELOMATIC_MEMORY_POOL_HXX */
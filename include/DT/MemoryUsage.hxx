@@ -0,0 +1,42 @@
+/*
+ * Filename:    MemoryUsage.hxx
+ *
+ * Description: Header file of namespace MemoryUsage.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_MEMORY_USAGE_HXX
+#define DELOMATIC_MEMORY_USAGE_HXX
+
+
+/**
+ * @brief Reports the resident set size (RSS) of the process.
+ */
+namespace MemoryUsage
+{
+    /**
+     * @brief Gets the current resident set size of the process.
+     *
+     * @return the current resident set size in MB, or 0 if it is not available
+     */
+    double getCurrentResidentSetSize();
+
+    /**
+     * @brief Gets the peak resident set size of the process since it started.
+     *
+     * @return the peak resident set size in MB, or 0 if it is not available
+     */
+    double getPeakResidentSetSize();
+
+    /**
+     * @brief Returns the free pages of the heap to the system. Small blocks that were freed in bulk, like the chunks
+     * of a MemoryPool, otherwise stay resident until the heap is reused, because the top of the heap can only shrink
+     * when no block is allocated after them. It does nothing if the C library does not support it.
+     */
+    void releaseFreeMemory();
+}
+
+
+#endif /* DELOMATIC_MEMORY_USAGE_HXX */
@@ -11,13 +11,41 @@
 #define DELOMATIC_MESH_HXX
 
 
-#include "Triangle.hxx"
+#include <array>
+#include <cstdint>
+#include <vector>
 
 
+using VertexIndex = uint32_t;
+
+using TriangleIndex = uint32_t;
+
+/**
+ * @brief Holds a triangulation in contiguous arrays with 32-bit indices.
+ * The i-th vertex is written with id i + 1 in the output files.
+ */
 struct Mesh
 {
-    std::vector<VertexHandle> vertices;
-    std::vector<TriangleHandle> triangles;
+    //  the neighbor of the boundary edges
+    static constexpr TriangleIndex NO_TRIANGLE = UINT32_MAX;
+
+    /**
+     * @brief Computes the neighbors of the triangles from their vertex indices. Cost: O(n)
+     * The i-th neighbor of a triangle is the triangle that has the edge from its (i + 1)-th vertex to its i-th vertex.
+     *
+     * @return the neighbors of the triangles, NO_TRIANGLE on the boundary
+     */
+    [[nodiscard]] std::vector<std::array<TriangleIndex, 3>> computeTriangleNeighbors() const;
+
+    //  coordinates of the vertices
+    std::vector<double> verticesX;
+    std::vector<double> verticesY;
+
+    //  position of each vertex in the input vertices of the triangulation
+    std::vector<VertexIndex> inputPositions;
+
+    //  indices of the vertices of each triangle
+    std::vector<std::array<VertexIndex, 3>> triangles;
 };
 
 
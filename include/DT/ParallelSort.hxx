@@ -0,0 +1,70 @@
+/*
+ * Filename:    ParallelSort.hxx
+ *
+ * Description: Header file of namespace ParallelSort.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_PARALLEL_SORT_HXX
+#define DELOMATIC_PARALLEL_SORT_HXX
+
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Vertex.hxx"
+
+
+/**
+ * @brief Parallel preprocessing of the input vertices: lexicographic sort, duplicate removal, and random permutation.
+ *
+ * The sort is a most-significant-digit radix sort on the bit patterns of the coordinates, which are mapped to
+ * unsigned integers in the order of the doubles. The first digit that splits the vertices is scattered by all threads,
+ * and its buckets are sorted recursively by the thread that takes them. The duplicates can also be removed without
+ * sorting, by hashing the same bit patterns.
+ */
+namespace ParallelSort
+{
+    /**
+     * @brief Sorts vertices lexicographically in descending order.
+     *
+     * @param vertices are the vertices
+     * @param numberOfThreads is the number of threads that sort the vertices
+     */
+    void sortLexicographically(std::vector<Vertex>& vertices, unsigned numberOfThreads = 1);
+
+    /**
+     * @brief Removes the duplicates of sorted vertices, keeping the first vertex of each run of equal vertices.
+     *
+     * @param vertices are the sorted vertices
+     * @param numberOfThreads is the number of threads that compact the vertices
+     */
+    void removeDuplicates(std::vector<Vertex>& vertices, unsigned numberOfThreads = 1);
+
+    /**
+     * @brief Removes the duplicates of unsorted vertices with an open-addressing hash set of the bit patterns of their
+     * coordinates, keeping the first vertex of each group of equal vertices in the order of the input. Each slot of
+     * the set holds a vertex and a fingerprint of its hash, so the probes rarely read the vertices. Expected cost: O(n)
+     *
+     * @param vertices are the vertices
+     * @param duplicates are the position of each removed vertex and the position of its surviving vertex, both in the
+     * input order
+     */
+    void removeDuplicatesByHashing(std::vector<Vertex>& vertices, std::vector<std::pair<size_t, size_t>>& duplicates);
+
+    /**
+     * @brief Shuffles vertices in a uniformly random permutation, which depends only on the vertices and the seed.
+     * The threads scatter their ranges of vertices to random buckets, whose number depends on the number of vertices,
+     * and then shuffle the buckets one by one, which gives every permutation the same probability.
+     *
+     * @param vertices are the vertices
+     * @param seed is the seed of the permutation
+     * @param numberOfThreads is the number of threads that shuffle the vertices
+     */
+    void shuffle(std::vector<Vertex>& vertices, uint64_t seed, unsigned numberOfThreads = 1);
+}
+
+
+#endif /* DELOMATIC_PARALLEL_SORT_HXX */
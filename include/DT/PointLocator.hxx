@@ -0,0 +1,88 @@
+/*
+ * Filename:    PointLocator.hxx
+ *
+ * Description: Header file of PointLocator class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_POINT_LOCATOR_HXX
+#define DELOMATIC_POINT_LOCATOR_HXX
+
+
+#include <array>
+#include <vector>
+#include "Mesh.hxx"
+#include "Vertex.hxx"
+
+
+/**
+ * @brief Locates query points in the triangles of a finished mesh.
+ *
+ * The queries are sorted along the Hilbert curve, and each one is found by a visibility walk that starts from the
+ * triangle of the previous query, therefore consecutive queries are a few steps apart. The sorted queries are split
+ * in contiguous ranges that are located by separate threads. The visibility walk terminates on a Delaunay
+ * triangulation whatever the order in which the edges are tested.
+ *
+ * The mesh must cover the convex hull of its vertices: a query that lies beyond a boundary edge is reported outside.
+ *
+ * @tparam Predicates is the predicate policy, GeometricPredicates::Fast or GeometricPredicates::Filtered
+ */
+template <typename Predicates>
+class PointLocator
+{
+public:
+    //  the triangle of the queries that lie outside of the mesh
+    static constexpr TriangleIndex NO_TRIANGLE = Mesh::NO_TRIANGLE;
+
+    /**
+     * @brief Constructor of PointLocator. It computes the neighbors of the triangles of the mesh.
+     *
+     * @param mesh is the mesh, which must outlive the locator
+     */
+    explicit PointLocator(const Mesh& mesh);
+
+    /**
+     * @brief Destructor of PointLocator.
+     */
+    ~PointLocator();
+
+    /**
+     * @brief Locates a point by walking from a given triangle.
+     *
+     * @param point is the point
+     * @param startTriangle is the triangle where the walk starts
+     * @return the triangle that contains the point, inside or on one of its edges, or NO_TRIANGLE
+     */
+    [[nodiscard]] TriangleIndex locate(const Vertex& point, TriangleIndex startTriangle = 0) const;
+
+    /**
+     * @brief Locates a batch of points.
+     *
+     * @param queries are the points
+     * @param numberOfThreads is the number of threads that locate the points
+     * @return the triangle of each point, in the order of the queries
+     */
+    [[nodiscard]] std::vector<TriangleIndex> locate(const std::vector<Vertex>& queries,
+                                                    unsigned numberOfThreads = 1) const;
+
+private:
+    /**
+     * @brief Walks towards a point.
+     *
+     * @param point are the coordinates of the point
+     * @param triangle is the triangle where the walk starts, and it becomes the last visited triangle
+     * @return the triangle that contains the point, or NO_TRIANGLE if the walk crosses the boundary of the mesh
+     */
+    TriangleIndex walkToTriangle(const double* point, TriangleIndex& triangle) const;
+
+private:
+    const Mesh& mesh;
+
+    //  the i-th neighbor of a triangle shares the edge from its i-th vertex to its (i + 1)-th vertex
+    std::vector<std::array<TriangleIndex, 3>> triangleNeighbors;
+};
+
+
+#endif /* DELOMATIC_POINT_LOCATOR_HXX */
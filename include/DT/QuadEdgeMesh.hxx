@@ -0,0 +1,233 @@
+/*
+ * Filename:    QuadEdgeMesh.hxx
+ *
+ * Description: Header file of QuadEdgeMesh class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_QUAD_EDGE_MESH_HXX
+#define DELOMATIC_QUAD_EDGE_MESH_HXX
+
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Mesh.hxx"
+
+
+//  directed edge: quad * 4 + rotation. Rotations 0 and 2 are the two directions of the primal edge,
+//  rotations 1 and 3 are the two directions of its dual edge.
+using EdgeIndex = uint32_t;
+
+/**
+ * @brief Quad-edge data structure of Guibas and Stolfi stored in 32-bit index arrays.
+ *
+ * Each quad stores the Onext ring links of its four directed edges and the origin vertices of its two primal edges.
+ * The quads live in fixed size chunks whose addresses are kept in a table that never moves, therefore several threads
+ * can create and delete edges at the same time, as long as each thread uses its own Allocator and works on a part
+ * of the mesh that no other thread touches.
+ */
+class QuadEdgeMesh
+{
+public:
+    static constexpr EdgeIndex NO_EDGE = UINT32_MAX;
+    static constexpr VertexIndex NO_VERTEX = UINT32_MAX;
+
+    /**
+     * @brief Hands out the quads of one thread: deleted quads first, then the unused part of its current chunk.
+     */
+    class Allocator
+    {
+    public:
+        /**
+         * @brief Takes over the deleted and the unused quads of another allocator whose thread has finished.
+         *
+         * @param other is the allocator of the finished thread
+         */
+        void absorb(Allocator& other);
+
+    private:
+        friend class QuadEdgeMesh;
+
+        uint32_t nextQuad = 0;
+        uint32_t endQuad = 0;
+        std::vector<uint32_t> freeQuads;
+    };
+
+    /**
+     * @brief Constructor of QuadEdgeMesh.
+     */
+    QuadEdgeMesh();
+
+    /**
+     * @brief Destructor of QuadEdgeMesh.
+     */
+    ~QuadEdgeMesh();
+
+    ////////////////////////////////////////////////////////////
+    //                    Edge Algebra                        //
+    ////////////////////////////////////////////////////////////
+
+    static EdgeIndex rot(EdgeIndex e)
+    {
+        return (e & ~3u) | ((e + 1) & 3u);
+    }
+
+    static EdgeIndex sym(EdgeIndex e)
+    {
+        return e ^ 2u;
+    }
+
+    static EdgeIndex rotInv(EdgeIndex e)
+    {
+        return (e & ~3u) | ((e + 3) & 3u);
+    }
+
+    [[nodiscard]] EdgeIndex onext(EdgeIndex e) const
+    {
+        return quad(e).next[e & 3u];
+    }
+
+    [[nodiscard]] EdgeIndex oprev(EdgeIndex e) const
+    {
+        return rot(onext(rot(e)));
+    }
+
+    [[nodiscard]] EdgeIndex lnext(EdgeIndex e) const
+    {
+        return rot(onext(rotInv(e)));
+    }
+
+    [[nodiscard]] EdgeIndex rprev(EdgeIndex e) const
+    {
+        return onext(sym(e));
+    }
+
+    /**
+     * @brief Gets the origin vertex of a primal edge.
+     */
+    [[nodiscard]] VertexIndex org(EdgeIndex e) const
+    {
+        return quad(e).origin[(e >> 1u) & 1u];
+    }
+
+    /**
+     * @brief Gets the destination vertex of a primal edge.
+     */
+    [[nodiscard]] VertexIndex dest(EdgeIndex e) const
+    {
+        return org(sym(e));
+    }
+
+    ////////////////////////////////////////////////////////////
+    //                    Topological Operators               //
+    ////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Creates an isolated edge.
+     *
+     * @param origin is the origin vertex of the edge
+     * @param destination is the destination vertex of the edge
+     * @param allocator is the allocator of the calling thread
+     * @return the edge that goes from origin to destination
+     */
+    EdgeIndex makeEdge(VertexIndex origin, VertexIndex destination, Allocator& allocator);
+
+    /**
+     * @brief Joins or separates the origin rings of a and b, and the left face rings of a and b.
+     */
+    void splice(EdgeIndex a, EdgeIndex b)
+    {
+        const EdgeIndex alpha = rot(onext(a));
+        const EdgeIndex beta = rot(onext(b));
+
+        std::swap(next(a), next(b));
+        std::swap(next(alpha), next(beta));
+    }
+
+    /**
+     * @brief Creates an edge from the destination of a to the origin of b, so that a, the new edge and b share the
+     * same left face.
+     *
+     * @param a is the edge whose destination is the origin of the new edge
+     * @param b is the edge whose origin is the destination of the new edge
+     * @param allocator is the allocator of the calling thread
+     * @return the new edge
+     */
+    EdgeIndex connect(EdgeIndex a, EdgeIndex b, Allocator& allocator);
+
+    /**
+     * @brief Disconnects an edge from the mesh and returns its quad to the allocator.
+     *
+     * @param e is the deleted edge
+     * @param allocator is the allocator of the calling thread
+     */
+    void deleteEdge(EdgeIndex e, Allocator& allocator);
+
+    /**
+     * @brief Gets the number of quad slots that have been allocated. Slots of deleted or unused quads are included.
+     *
+     * @return the number of quad slots
+     */
+    [[nodiscard]] uint32_t numberOfQuads() const
+    {
+        return numberOfChunks.load() << CHUNK_BITS;
+    }
+
+    /**
+     * @brief Checks if a quad slot holds an edge of the mesh.
+     *
+     * @param quadIndex is the index of the quad
+     * @return if the quad slot holds an edge of the mesh
+     */
+    [[nodiscard]] bool isUsed(uint32_t quadIndex) const
+    {
+        return quad(quadIndex << 2u).origin[0] != NO_VERTEX;
+    }
+
+    /**
+     * @brief Releases all the quads.
+     */
+    void release();
+
+private:
+    struct QuadEdge
+    {
+        std::array<EdgeIndex, 4> next;
+        std::array<VertexIndex, 2> origin;
+    };
+
+    static constexpr uint32_t CHUNK_BITS = 14;
+    static constexpr uint32_t CHUNK_SIZE = 1u << CHUNK_BITS;
+    //  32-bit directed edges address 2^30 quads
+    static constexpr uint32_t MAX_CHUNKS = 1u << (30 - CHUNK_BITS);
+
+    QuadEdge& quad(EdgeIndex e)
+    {
+        const uint32_t quadIndex = e >> 2u;
+        return chunks[quadIndex >> CHUNK_BITS][quadIndex & (CHUNK_SIZE - 1)];
+    }
+
+    [[nodiscard]] const QuadEdge& quad(EdgeIndex e) const
+    {
+        const uint32_t quadIndex = e >> 2u;
+        return chunks[quadIndex >> CHUNK_BITS][quadIndex & (CHUNK_SIZE - 1)];
+    }
+
+    EdgeIndex& next(EdgeIndex e)
+    {
+        return quad(e).next[e & 3u];
+    }
+
+    //  table of MAX_CHUNKS entries, allocated once so that it never moves while threads add chunks
+    std::vector<std::unique_ptr<QuadEdge[]>> chunks;
+
+    std::atomic<uint32_t> numberOfChunks{0};
+};
+
+
+#endif /* DELOMATIC_QUAD_EDGE_MESH_HXX */
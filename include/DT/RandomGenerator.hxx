@@ -0,0 +1,159 @@
+/*
+ * Filename:    RandomGenerator.hxx
+ *
+ * Description: Header file of RandomGenerator class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_RANDOM_GENERATOR_HXX
+#define DELOMATIC_RANDOM_GENERATOR_HXX
+
+
+#include <cstdint>
+#include <utility>
+
+
+/**
+ * @brief Streams of random numbers, one for each use of the seed.
+ */
+enum class RandomStream : uint64_t
+{
+    //  coordinates of the generated input vertices
+    InputVertices,
+    //  insertion order of the incremental engines
+    InsertionOrder,
+    //  coordinates of the point location queries
+    LocateQueries,
+    //  centers of the clusters and endpoints of the segments of the generated input vertices
+    InputShapes
+};
+
+/**
+ * @brief Counter-based pseudo-random generator (SplitMix64).
+ *
+ * The i-th number of a stream is a bijective mix of a key, which is derived from the seed and the stream, and of the
+ * counter i. Therefore a thread jumps to the numbers of its range in constant time, and the numbers do not depend on
+ * the number of threads. The bounded integers and the real numbers are computed here rather than by the distributions
+ * of the standard library, whose results differ between implementations.
+ */
+class RandomGenerator
+{
+public:
+    using result_type = uint64_t;
+
+    /**
+     * @brief Constructor of RandomGenerator.
+     *
+     * @param seed is the seed
+     * @param stream is the stream of the seed, the streams of a seed are independent
+     * @param counter is the index of the first number
+     */
+    RandomGenerator(uint64_t seed, uint64_t stream, uint64_t counter = 0)
+            : key(mixBits(seed ^ mixBits(stream + GOLDEN_GAMMA))), counter(counter)
+    {
+    }
+
+    /**
+     * @brief Constructor of RandomGenerator for a named stream.
+     *
+     * @param seed is the seed
+     * @param stream is the stream of the seed
+     * @param counter is the index of the first number
+     */
+    RandomGenerator(uint64_t seed, RandomStream stream, uint64_t counter = 0)
+            : RandomGenerator(seed, static_cast<uint64_t>(stream), counter)
+    {
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return UINT64_MAX;
+    }
+
+    /**
+     * @brief Generates the next number of the stream.
+     */
+    result_type operator()()
+    {
+        return mixBits(key + GOLDEN_GAMMA * ++counter);
+    }
+
+    /**
+     * @brief Skips numbers of the stream.
+     *
+     * @param numberOfSkippedNumbers is the number of skipped numbers
+     */
+    void discard(uint64_t numberOfSkippedNumbers)
+    {
+        counter += numberOfSkippedNumbers;
+    }
+
+    /**
+     * @brief Generates a uniformly random integer in [0, bound) without bias (Lemire's multiply-shift method).
+     *
+     * @param bound is the bound, which must be positive
+     * @return the integer
+     */
+    uint64_t uniformInteger(uint64_t bound)
+    {
+        __uint128_t product = static_cast<__uint128_t>((*this)()) * bound;
+        if (static_cast<uint64_t>(product) < bound) {
+            //  the products whose lower half is below 2^64 mod bound are rejected
+            const uint64_t threshold = -bound % bound;
+            while (static_cast<uint64_t>(product) < threshold) {
+                product = static_cast<__uint128_t>((*this)()) * bound;
+            }
+        }
+
+        return static_cast<uint64_t>(product >> 64u);
+    }
+
+    /**
+     * @brief Generates a uniformly random real number in [0, 1) with 53 random bits.
+     */
+    double uniformReal()
+    {
+        return static_cast<double>((*this)() >> 11u) * 0x1.0p-53;
+    }
+
+    /**
+     * @brief Shuffles a range in a uniformly random permutation (Fisher-Yates).
+     *
+     * @tparam Iterator is a random access iterator
+     * @param first is the first item of the range
+     * @param last is the item after the last item of the range
+     */
+    template <typename Iterator>
+    void shuffle(Iterator first, Iterator last)
+    {
+        for (auto i = static_cast<uint64_t>(last - first); i > 1; --i) {
+            std::swap(first[i - 1], first[uniformInteger(i)]);
+        }
+    }
+
+private:
+    /**
+     * @brief Mixes the bits of a 64-bit integer (finalizer of SplitMix64).
+     */
+    static uint64_t mixBits(uint64_t value)
+    {
+        value = (value ^ (value >> 30u)) * UINT64_C(0xbf58476d1ce4e5b9);
+        value = (value ^ (value >> 27u)) * UINT64_C(0x94d049bb133111eb);
+        return value ^ (value >> 31u);
+    }
+
+    static constexpr uint64_t GOLDEN_GAMMA = UINT64_C(0x9e3779b97f4a7c15);
+
+    uint64_t key;
+    uint64_t counter;
+};
+
+
+#endif /* DELOMATIC_RANDOM_GENERATOR_HXX */
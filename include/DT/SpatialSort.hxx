@@ -0,0 +1,59 @@
+/*
+ * Filename:    SpatialSort.hxx
+ *
+ * Description: Header file of namespace SpatialSort.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_SPATIAL_SORT_HXX
+#define DELOMATIC_SPATIAL_SORT_HXX
+
+
+#include <cstdint>
+#include <vector>
+#include "Vertex.hxx"
+
+
+namespace SpatialSort
+{
+    /**
+     * @brief Computes the index of a cell of a 2^32 x 2^32 grid along the Hilbert curve.
+     *
+     * @param x is the column of the cell
+     * @param y is the row of the cell
+     * @return the index of the cell along the Hilbert curve
+     */
+    uint64_t hilbertIndex(uint32_t x, uint32_t y);
+
+    /**
+     * @brief Sorts a range of vertices along the Hilbert curve of the bounding box of the range.
+     *
+     * @param vertices are the vertices
+     * @param first is the first vertex of the range
+     * @param last is the vertex after the last vertex of the range
+     */
+    void sortAlongHilbertCurve(std::vector<Vertex>& vertices, size_t first, size_t last);
+
+    /**
+     * @brief Computes the order of vertices along the Hilbert curve of their bounding box, without moving them.
+     *
+     * @param vertices are the vertices
+     * @return the indices of the vertices in the order of the Hilbert curve
+     */
+    std::vector<uint32_t> computeHilbertOrder(const std::vector<Vertex>& vertices);
+
+    /**
+     * @brief Computes a Biased Randomized Insertion Order of shuffled vertices.
+     * The vertices are split in rounds of doubling size, [0, n / 2^k), ..., [n / 4, n / 2), [n / 2, n),
+     * and each round is sorted along the Hilbert curve. Since the vertices are shuffled, each round is a random
+     * sample, while consecutive vertices of a round are close to each other.
+     *
+     * @param vertices are the shuffled vertices
+     */
+    void computeBiasedRandomizedInsertionOrder(std::vector<Vertex>& vertices);
+}
+
+
+#endif /* DELOMATIC_SPATIAL_SORT_HXX */
@@ -0,0 +1,169 @@
+/*
+ * Filename:    SweepHullTriangulation.hxx
+ *
+ * Description: Header file of SweepHullTriangulation class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_SWEEP_HULL_TRIANGULATION_HXX
+#define DELOMATIC_SWEEP_HULL_TRIANGULATION_HXX
+
+
+#include <random>
+#include <vector>
+#include "Triangulation.hxx"
+
+
+/**
+ * @brief Sweep-hull Delaunay Triangulation, which grows the triangulation from its convex hull instead of a bounding
+ * triangle.
+ *
+ * A vertex that lies outside the current triangulation is connected to the convex hull edges that it sees, and a
+ * vertex inside it splits the triangle or the edge that contains it. Either way the new edges are legalized by flips.
+ * The vertices are inserted in Biased Randomized Insertion Order and located by walking from the last created
+ * triangle, where a walk that crosses a hull edge has found a visible hull edge. A sorted sweep, where every vertex
+ * lies outside the hull, would take O(n^2) flips on grids and segments, because each vertex at the end of a row
+ * takes over the fan of triangles of the previous one. No bounding triangle and no History DAG are needed, and the
+ * flips reuse the slots of the flipped triangles, therefore the arrays hold exactly the triangles of the mesh.
+ *
+ * Triangles are stored like in CompactDelaunayTriangulation: three 32-bit vertex indices in clockwise order and
+ * three 32-bit neighbor codes (triangle * 4 + edgeId).
+ *
+ * @tparam Predicates is the predicate policy, GeometricPredicates::Fast or GeometricPredicates::Filtered
+ */
+template <typename Predicates>
+class SweepHullTriangulation : public Triangulation
+{
+public:
+    /**
+     * @brief Constructor of SweepHullTriangulation.
+     */
+    SweepHullTriangulation();
+
+    /**
+     * @brief Destructor of SweepHullTriangulation.
+     */
+    ~SweepHullTriangulation() override;
+
+    /**
+     * @brief Sets the input vertices of the triangulation.
+     *
+     * @param vertices are the input vertices
+     * @param numberOfThreads is the number of threads that sort, deduplicate, and shuffle the vertices
+     */
+    void setInputVertices(std::vector<Vertex>& vertices, unsigned numberOfThreads = 1) override;
+
+private:
+    /**
+     * @brief Computes the orientation of three vertices.
+     *
+     * @return a positive value if they make a counterclockwise turn, a negative value if they make a clockwise turn,
+     * and zero if they are collinear
+     */
+    [[nodiscard]] double orientation(VertexIndex a, VertexIndex b, VertexIndex c) const;
+
+    /**
+     * @brief Creates a triangle without neighbors.
+     *
+     * @param Pi is the first vertex of the triangle
+     * @param Pj is the second vertex of the triangle
+     * @param Pk is the third vertex of the triangle
+     * @return the index of the new triangle
+     */
+    TriangleIndex createTriangle(VertexIndex Pi, VertexIndex Pj, VertexIndex Pk);
+
+    /**
+     * @brief Connects an edge of a triangle with the given neighbor, and the neighbor with the triangle. An edge
+     * without neighbor lies on the convex hull and it is recorded as such.
+     *
+     * @param triangle is the triangle
+     * @param edgeId is the id of the edge of the triangle
+     * @param neighbor is the neighbor code of the adjacent triangle, or NO_NEIGHBOR
+     */
+    void setNeighbor(TriangleIndex triangle, int edgeId, TriangleIndex neighbor);
+
+    /**
+     * @brief Triangulates the first vertices up to the first one that is not collinear with the previous ones.
+     * The collinear vertices are sorted along their line first.
+     *
+     * @return the number of triangulated vertices, or 0 if all vertices are collinear
+     */
+    VertexIndex createInitialTriangulation();
+
+    /**
+     * @brief Locates a vertex by walking from the last created triangle, and inserts it in the triangle or the edge
+     * that contains it, or connects it with the convex hull if the walk crosses a hull edge. At each triangle the
+     * edges are tested starting from a random one, and the edge through which the walk entered the triangle is
+     * skipped (remembering stochastic walk).
+     *
+     * @param vertex is the inserted vertex
+     */
+    void insertVertex(VertexIndex vertex);
+
+    /**
+     * @brief Connects a vertex that lies outside of the triangulation with the convex hull edges that it sees.
+     *
+     * @param vertex is the inserted vertex
+     * @param hullVertex is the first vertex of a hull edge that the vertex sees
+     */
+    void insertVertexOutsideHull(VertexIndex vertex, VertexIndex hullVertex);
+
+    /**
+     * @brief Inserts a vertex in the triangle that contains it, splitting the triangle, or the edge that it lies on.
+     *
+     * @param vertex is the inserted vertex
+     * @param triangle is the triangle that contains the vertex
+     * @param orientationTests are the orientations of the vertex against the edges of the triangle
+     */
+    void insertVertexInTriangle(VertexIndex vertex, TriangleIndex triangle,
+                                const std::array<double, 3>& orientationTests);
+
+    /**
+     * @brief Legalizes the edges of the legalization stack by flipping them in place, and then the edges that the
+     * flips expose. The edges are kept in an explicit stack instead of the call stack, therefore long flip cascades
+     * cannot overflow it.
+     */
+    void legalizeEdges();
+
+    /**
+     * @brief Stores the triangles in the output mesh.
+     */
+    void createOutputMesh();
+
+public:
+    /**
+     * @brief Generates the Delaunay Mesh of the input vertices.
+     */
+    void generateMesh() override;
+
+private:
+    static constexpr VertexIndex NO_VERTEX = UINT32_MAX;
+    static constexpr TriangleIndex NO_NEIGHBOR = UINT32_MAX;
+
+    //  vertices in insertion order
+    std::vector<double> verticesX;
+    std::vector<double> verticesY;
+
+    std::vector<std::array<VertexIndex, 3>> triangleVertices;
+    std::vector<std::array<TriangleIndex, 3>> triangleNeighbors;
+
+    //  convex hull as a counterclockwise doubly linked list of vertices. The hull edge that starts from a vertex is
+    //  stored in the triangle with the neighbor code hullTriangle[vertex], in the opposite (clockwise) direction.
+    std::vector<VertexIndex> hullNext;
+    std::vector<VertexIndex> hullPrevious;
+    std::vector<TriangleIndex> hullTriangle;
+
+    //  neighbor codes of the edges that wait to be legalized, whose apex is the last inserted vertex
+    std::vector<TriangleIndex> legalizationStack;
+
+    //  last created triangle, where the walk starts
+    TriangleIndex lastCreatedTriangle = 0;
+
+    //  chooses the first edge tested by the walk at each triangle
+    std::minstd_rand walkRandomGenerator;
+};
+
+
+#endif /* DELOMATIC_SWEEP_HULL_TRIANGULATION_HXX */
@@ -11,14 +11,11 @@
 #define DELOMATIC_TRIANGLE_HXX
 
 
+#include <cstdint>
 #include <vector>
 #include "Vertex.hxx"
 
 
-class Edge;
-
-using EdgeHandle = Edge*;
-
 class Triangle;
 
 using TriangleHandle = Triangle*;
@@ -39,11 +36,13 @@ public:
     ~Triangle();
 
     /**
-     * @brief Sets the edges of the triangle.
+     * @brief Connects an edge of the triangle with an adjacent triangle, and the adjacent triangle with this one.
      *
-     * @param edges are the edge of the triangle
+     * @param edgeId is the id of the edge of the triangle
+     * @param neighbor is the adjacent triangle, or nullptr if the edge is a boundary edge
+     * @param neighborEdgeId is the id of the same edge in the adjacent triangle
      */
-    void setEdges(std::array<EdgeHandle, 3> edges);
+    void setNeighbor(int edgeId, const TriangleHandle& neighbor, int neighborEdgeId);
 
     /**
      * @brief Checks if a vertex is part of a triangle.
@@ -54,18 +53,23 @@ public:
     [[nodiscard]] bool containsVertex(const VertexHandle& vertex) const;
 
 public:
+    //  the i-th edge goes from the i-th vertex to the (i + 1)-th vertex
     std::array<VertexHandle, 3> vertices;
 
-    std::array<EdgeHandle, 3> edges;
+    //  the i-th neighbor is the triangle on the other side of the i-th edge, nullptr for boundary edges
+    std::array<TriangleHandle, 3> neighbors;
+
+    //  the id of the i-th edge inside the i-th neighbor
+    std::array<unsigned char, 3> neighborEdgeIds;
 
     ////////////////////////////////////////////////////////////////
     //                   Information used by DAG                  //
     ////////////////////////////////////////////////////////////////
 
-    //  children triangles in DAG
-    std::vector<TriangleHandle> childrenTriangles;
+    //  index of the node of the triangle in DAG
+    uint32_t dagNode;
 
-    //  used to extract triangulation in DAG
+    //  used to extract triangulation from the neighbors
     bool visitedTriangle;
 };
 
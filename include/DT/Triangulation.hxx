@@ -0,0 +1,187 @@
+/*
+ * Filename:    Triangulation.hxx
+ *
+ * Description: Header file of Triangulation class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#ifndef DELOMATIC_TRIANGULATION_HXX
+#define DELOMATIC_TRIANGULATION_HXX
+
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Mesh.hxx"
+#include "Timer.hxx"
+#include "Vertex.hxx"
+
+
+/**
+ * @brief Point location strategies of the incremental engines.
+ */
+enum class PointLocation
+{
+    //  descends the History DAG from the bounding triangle
+    HistoryDAG,
+    //  walks the current triangulation from the last created triangle (remembering stochastic walk)
+    Walk
+};
+
+/**
+ * @brief Insertion orders of the incremental engines.
+ */
+enum class InsertionOrder
+{
+    //  random permutation of the vertices
+    Random,
+    //  Biased Randomized Insertion Order, random rounds sorted along the Hilbert curve
+    BRIO
+};
+
+/**
+ * @brief Duplicate removal strategies of the input vertices.
+ */
+enum class DuplicateRemoval
+{
+    //  sorts the vertices lexicographically and removes the runs of equal vertices
+    Sort,
+    //  inserts the vertices in a hash set, and remembers the surviving vertex of each duplicate
+    Hash
+};
+
+/**
+ * @brief Base class of the Delaunay Triangulation engines.
+ */
+class Triangulation
+{
+public:
+    /**
+     * @brief Constructor of Triangulation.
+     *
+     * @param robustPredicates is a boolean value that indicates if robust predicates are used by the engine
+     */
+    explicit Triangulation(bool robustPredicates);
+
+    /**
+     * @brief Destructor of Triangulation.
+     */
+    virtual ~Triangulation();
+
+    /**
+     * @brief Sets the input vertices of the triangulation.
+     *
+     * @param vertices are the input vertices
+     * @param numberOfThreads is the number of threads that sort, deduplicate, and shuffle the vertices
+     */
+    virtual void setInputVertices(std::vector<Vertex>& vertices, unsigned numberOfThreads = 1) = 0;
+
+    /**
+     * @brief Sets how the duplicates of the input vertices are removed. It must be called before setInputVertices.
+     *
+     * @param duplicateRemoval is the duplicate removal strategy
+     */
+    void setDuplicateRemoval(DuplicateRemoval duplicateRemoval);
+
+    /**
+     * @brief Sets the seed of the random insertion order. It must be called before setInputVertices.
+     *
+     * @param seed is the seed
+     */
+    void setSeed(uint64_t seed);
+
+    /**
+     * @brief Gets the number of duplicate input vertices that were removed.
+     */
+    [[nodiscard]] size_t getNumberOfDuplicateVertices() const;
+
+    /**
+     * @brief Gets the number of edge flips of the last generateMesh. Divide-and-conquer merges without flips.
+     */
+    [[nodiscard]] uint64_t getNumberOfFlips() const;
+
+    /**
+     * @brief Gets the position of each removed input vertex and the position of its surviving vertex, both in the
+     * order of the input vertices. They are only computed by DuplicateRemoval::Hash. The mesh vertex of a surviving
+     * vertex is found through Mesh::inputPositions.
+     */
+    [[nodiscard]] const std::vector<std::pair<size_t, size_t>>& getDuplicateVertices() const;
+
+    /**
+     * @brief Generates the Delaunay Mesh of the input vertices.
+     */
+    virtual void generateMesh() = 0;
+
+    /**
+     * @brief Validates if the output mesh is a valid triangulation that uses each of its vertices, if its boundary is
+     * convex, and if each of its edges is locally Delaunay. Locally Delaunay edges make the mesh Delaunay only on a
+     * convex domain, therefore a reflex boundary vertex fails the validation, and so does a vertex that no triangle
+     * uses. Cost: O(n)
+     *
+     * @param numberOfThreads is the number of threads that validate the triangles
+     */
+    void validateDelaunayTriangulation(unsigned numberOfThreads = 1);
+
+    /**
+     * @brief Gets outputMesh.
+     */
+    [[nodiscard]] const Mesh& getOutputMesh() const;
+
+protected:
+    /**
+     * @brief Sorts the vertices lexicographically in descending order and removes the duplicates. The id of each
+     * remaining vertex is its position in the input vertices.
+     *
+     * @param vertices are the input vertices
+     * @param numberOfThreads is the number of threads that sort and deduplicate the vertices
+     */
+    void sortAndRemoveDuplicates(std::vector<Vertex>& vertices, unsigned numberOfThreads);
+
+    /**
+     * @brief Removes the duplicates of the vertices and shuffles them. The vertices are sorted only by
+     * DuplicateRemoval::Sort. The id of each remaining vertex is its position in the input vertices.
+     *
+     * @param vertices are the input vertices
+     * @param insertionOrder is the order in which the shuffled vertices will be inserted
+     * @param numberOfThreads is the number of threads that sort, deduplicate, and shuffle the vertices
+     */
+    void removeDuplicatesAndShuffle(std::vector<Vertex>& vertices, InsertionOrder insertionOrder,
+                                    unsigned numberOfThreads);
+
+private:
+    /**
+     * @brief Stores the position of each input vertex in its id.
+     *
+     * @param vertices are the input vertices
+     */
+    static void setInputPositions(std::vector<Vertex>& vertices);
+
+    /**
+     * @brief Removes the duplicates of unsorted vertices by hashing, and remembers their surviving vertices.
+     *
+     * @param vertices are the input vertices
+     */
+    void removeDuplicatesByHashing(std::vector<Vertex>& vertices);
+
+protected:
+    //  the engines use the predicates of their template argument, the validation chooses them with this flag
+    bool robustPredicates;
+
+    DuplicateRemoval duplicateRemoval = DuplicateRemoval::Sort;
+    uint64_t seed = 0;
+    size_t numberOfDuplicateVertices = 0;
+    std::vector<std::pair<size_t, size_t>> duplicateVertices;
+    uint64_t numberOfFlips = 0;
+
+    //  position in the input vertices of each vertex of the engine, which is handed over to outputMesh
+    std::vector<VertexIndex> inputPositions;
+
+    Mesh outputMesh;
+public:
+    Timer computeBoundaryTriangleTimer{}, meshingTimer{}, validateDelaunayTriangulationTimer{};
+};
+
+
+#endif /* DELOMATIC_TRIANGULATION_HXX */
@@ -55,6 +55,7 @@ public:
     /**
      * @brief This id is used to define vertex for edge and to print fast the triangulation
      * If id =  0, that's the default.
+     * The preprocessing of the triangulation stores the position of each input vertex in its id.
      * If id = -3, it's the first vertex of the boundary triangle
      * If id = -2, it's the second vertex of the boundary triangle
      * If id = -1, it's the third vertex of the boundary triangle
@@ -11,6 +11,7 @@
 #define DELOMATIC_ARGS_HXX
 
 
+#include <cstdint>
 #include <iosfwd>
 #include <string>
 
@@ -24,10 +25,22 @@ namespace Args
     // CLI Arguments
     ////////////////////////////////////////////
     extern std::string inputFileName;
+    extern std::string inputFormat;
     extern size_t numberOfRandomVertices;
+    extern std::string randomDistribution;
     extern bool robustPredicates;
+    extern std::string algorithm;
+    extern unsigned numberOfThreads;
+    extern bool compactMesh;
+    extern std::string pointLocation;
+    extern std::string insertionOrder;
+    extern std::string duplicateRemoval;
+    extern uint64_t seed;
     extern bool validateDelaunayProperty;
+    extern size_t numberOfLocateQueries;
     extern std::string outputFileName;
+    extern std::string outputFormat;
+    extern bool outputNeighbors;
 
     /**
      * @brief Parse Command line Arguments.
@@ -11,6 +11,8 @@
 #define DELOMATIC_IO_HXX
 
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "Mesh.hxx"
@@ -20,29 +22,193 @@
 namespace Io
 {
     /**
-     * @brief Reads input .node file.
+     * @brief Formats of the input vertices.
+     */
+    enum class InputFormat
+    {
+        //  chosen by the extension of the file: Float64 for .dpts, .xy and .f64, Float32 for .f32, Node otherwise
+        Automatic,
+        //  .node file of Triangle
+        Node,
+        //  little-endian (x, y) pairs of float64, raw or after a BinaryPointsHeader
+        Float64,
+        //  little-endian (x, y) pairs of float32, raw or after a BinaryPointsHeader
+        Float32
+    };
+
+    /**
+     * @brief Optional header of a binary point cloud. All values are little-endian.
+     *
+     * The header is followed by the (x, y) pairs of the vertices, which start at their offset from the beginning of
+     * the file. A binary input file that does not start with the magic is read as raw pairs of its input format.
+     */
+    struct BinaryPointsHeader
+    {
+        static constexpr std::array<char, 8> MAGIC = {'D', 'E', 'L', 'O', 'P', 'N', 'T', 'S'};
+        static constexpr uint32_t VERSION = 1;
+
+        std::array<char, 8> magic;
+        uint32_t version;
+        //  8 for float64 coordinates, 4 for float32 coordinates
+        uint32_t bytesPerCoordinate;
+        uint64_t numberOfVertices;
+        uint64_t verticesOffset;
+    };
+
+    static_assert(sizeof(BinaryPointsHeader) == 32, "the header of a binary point cloud has 32 bytes");
+
+    /**
+     * @brief Distributions of the random input vertices.
+     */
+    enum class RandomDistribution
+    {
+        //  uniform in the square [0, 10^6)^2
+        Uniform,
+        //  normal around a few uniformly random centers of the square
+        GaussianClusters,
+        //  uniform on the circle inscribed in the square, cocircular up to the rounding of the coordinates
+        Circle,
+        //  the integer points of a square grid in row-major order, which are collinear and cocircular in many ways
+        Grid,
+        //  Kuzmin disk around the center of the square, whose density falls with the cube of the radius
+        Kuzmin,
+        //  uniform on a few random segments of the square, collinear up to the rounding of the coordinates
+        LineSegments
+    };
+
+    /**
+     * @brief Formats of the output mesh.
+     */
+    enum class OutputFormat
+    {
+        //  .node and .ele files of Triangle
+        Text,
+        //  a .dmesh file, whose arrays can be mapped in memory without parsing
+        Binary
+    };
+
+    /**
+     * @brief Header of a .dmesh file. All values are little-endian.
+     *
+     * The header is followed by the x coordinates (float64), the y coordinates (float64), the vertex indices of the
+     * triangles (3 x uint32, clockwise), and optionally the neighbors of the triangles (3 x uint32). The i-th neighbor
+     * of a triangle shares the edge from its i-th vertex to its (i + 1)-th vertex, and it is UINT32_MAX on the
+     * boundary. Each array starts at its offset from the beginning of the file, which is a multiple of 8.
+     */
+    struct BinaryMeshHeader
+    {
+        static constexpr std::array<char, 8> MAGIC = {'D', 'E', 'L', 'O', 'M', 'E', 'S', 'H'};
+        static constexpr uint32_t VERSION = 1;
+
+        std::array<char, 8> magic;
+        uint32_t version;
+        //  1 if the neighbors of the triangles are stored, 0 otherwise
+        uint32_t hasNeighbors;
+        uint64_t numberOfVertices;
+        uint64_t numberOfTriangles;
+        uint64_t verticesXOffset;
+        uint64_t verticesYOffset;
+        uint64_t trianglesOffset;
+        uint64_t neighborsOffset;
+    };
+
+    static_assert(sizeof(BinaryMeshHeader) == 64, "the header of a .dmesh file has 64 bytes");
+
+    /**
+     * @brief A .dmesh file mapped in memory. Its arrays point into the mapping, and no value is copied or parsed.
+     */
+    class MappedMesh
+    {
+    public:
+        /**
+         * @brief Constructor of MappedMesh. It exits if the file is not a valid .dmesh file.
+         *
+         * @param filename is the file name of the .dmesh file
+         */
+        explicit MappedMesh(const std::string& filename);
+
+        /**
+         * @brief Destructor of MappedMesh. It unmaps the file.
+         */
+        ~MappedMesh();
+
+        MappedMesh(const MappedMesh&) = delete;
+
+        MappedMesh& operator=(const MappedMesh&) = delete;
+
+        /**
+         * @brief Gets the number of vertices.
+         */
+        [[nodiscard]] size_t getNumberOfVertices() const;
+
+        /**
+         * @brief Gets the number of triangles.
+         */
+        [[nodiscard]] size_t getNumberOfTriangles() const;
+
+        /**
+         * @brief Gets the x coordinates of the vertices.
+         */
+        [[nodiscard]] const double* getVerticesX() const;
+
+        /**
+         * @brief Gets the y coordinates of the vertices.
+         */
+        [[nodiscard]] const double* getVerticesY() const;
+
+        /**
+         * @brief Gets the vertex indices of the triangles.
+         */
+        [[nodiscard]] const std::array<VertexIndex, 3>* getTriangles() const;
+
+        /**
+         * @brief Gets the neighbors of the triangles, or nullptr if they are not stored.
+         */
+        [[nodiscard]] const std::array<TriangleIndex, 3>* getTriangleNeighbors() const;
+
+    private:
+        void* mapping;
+        size_t fileSize;
+        const BinaryMeshHeader* header;
+    };
+
+    /**
+     * @brief Reads input .node file, whose vertex lines are parsed in parallel chunks, or a binary point cloud,
+     * which is mapped in memory and converted in parallel ranges without parsing.
      *
-     * @param filename is the file name of the .node file
-     * @return return a set of input vertices
+     * @param filename is the file name of the input file
+     * @param numberOfThreads is the number of threads that parse or convert the file
+     * @param inputFormat is the format of the input file
+     * @return return a set of input vertices in the order of the file
      */
-    std::vector<Vertex> readInput(const std::string& filename);
+    std::vector<Vertex> readInput(const std::string& filename, unsigned numberOfThreads = 1,
+                                  InputFormat inputFormat = InputFormat::Automatic);
 
     /**
-     * @brief Generates a set of random uniform vertices.
+     * @brief Generates a set of random vertices in parallel ranges. The i-th vertex depends only on the seed and i, so
+     * the set does not depend on the number of threads.
      *
      * @param numberOfRandomVertices is the amount of vertices that will be created
+     * @param seed is the seed of the coordinates
+     * @param randomDistribution is the distribution of the vertices
+     * @param numberOfThreads is the number of threads that generate the vertices
      *
-     * @return a set of random uniform vertices
+     * @return a set of random vertices
      */
-    std::vector<Vertex> generateUniformRandomInput(const size_t& numberOfRandomVertices);
+    std::vector<Vertex> generateRandomInput(const size_t& numberOfRandomVertices, uint64_t seed,
+                                            RandomDistribution randomDistribution = RandomDistribution::Uniform,
+                                            unsigned numberOfThreads = 1);
 
     /**
-     * @brief Prints output .node, .edge, and .ele files.
+     * @brief Prints output .node and .ele files, or a .dmesh file.
      *
      * @param mesh the triangulated mesh
      * @param filename the filename of outputFiles.
+     * @param outputFormat is the format of the output files
+     * @param outputNeighbors is true if the neighbors of the triangles are stored in the .dmesh file
      */
-    void printMesh(const Mesh& mesh, const std::string& filename);
+    void printMesh(const Mesh& mesh, const std::string& filename, OutputFormat outputFormat = OutputFormat::Text,
+                   bool outputNeighbors = false);
 }
 
 
@@ -0,0 +1,524 @@
+/*
+ * Filename:    CompactDelaunayTriangulation.cxx
+ *
+ * Description: Source file of CompactDelaunayTriangulation class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <algorithm>
+#include "GeometricPredicates.hxx"
+#include "CompactDelaunayTriangulation.hxx"
+#include "MemoryUsage.hxx"
+
+
+//  Fast lookup arrays to speed up the mesh manipulation primitives
+static constexpr int plus1mod3[3] = {1, 2, 0};
+static constexpr int minus1mod3[3] = {2, 0, 1};
+
+////////////////////////////////////////////////////////////
+//                    Neighbor Codes                      //
+////////////////////////////////////////////////////////////
+
+static inline TriangleIndex neighborCode(TriangleIndex triangle, int edgeId)
+{
+    return (triangle << 2u) | static_cast<TriangleIndex>(edgeId);
+}
+
+static inline TriangleIndex neighborTriangle(TriangleIndex neighbor)
+{
+    return neighbor >> 2u;
+}
+
+static inline int neighborEdgeId(TriangleIndex neighbor)
+{
+    return static_cast<int>(neighbor & 3u);
+}
+
+template <typename Predicates>
+CompactDelaunayTriangulation<Predicates>::CompactDelaunayTriangulation(PointLocation pointLocation,
+                                                                       InsertionOrder insertionOrder)
+        : Triangulation(Predicates::robust), pointLocation(pointLocation), insertionOrder(insertionOrder)
+{
+}
+
+template <typename Predicates>
+CompactDelaunayTriangulation<Predicates>::~CompactDelaunayTriangulation() = default;
+
+template <typename Predicates>
+void CompactDelaunayTriangulation<Predicates>::setInputVertices(std::vector<Vertex>& vertices, unsigned numberOfThreads)
+{
+    removeDuplicatesAndShuffle(vertices, insertionOrder, numberOfThreads);
+
+    numberOfMeshVertices = static_cast<VertexIndex>(vertices.size());
+
+    //  extract unique vertices, leaving room for the vertices of the bounding triangle. Cost O(n)
+    verticesX.clear();
+    verticesY.clear();
+    verticesX.reserve(vertices.size() + 3);
+    verticesY.reserve(vertices.size() + 3);
+    inputPositions.clear();
+    inputPositions.reserve(vertices.size());
+    for (auto& vertex : vertices) {
+        verticesX.push_back(vertex[0]);
+        verticesY.push_back(vertex[1]);
+        inputPositions.push_back(static_cast<VertexIndex>(vertex.id));
+    }
+    vertices.clear();
+}
+
+template <typename Predicates>
+void CompactDelaunayTriangulation<Predicates>::createBoundingTriangle()
+{
+    std::cout << std::endl << "Compute Bounding Triangle..." << std::endl;
+
+    computeBoundaryTriangleTimer.startTimer();
+
+    auto [minX, maxX] = std::minmax_element(verticesX.begin(), verticesX.end());
+    auto [minY, maxY] = std::minmax_element(verticesY.begin(), verticesY.end());
+
+    const double midX = (*minX + *maxX) / 2;
+    const double midY = (*minY + *maxY) / 2;
+    const double maxWidth = std::max(*maxX - *minX, *maxY - *minY);
+    const double multiplier = 100.0;
+
+    //  Pi, Pj, and Pk are stored right after the input vertices
+    verticesX.push_back(midX - multiplier * maxWidth);
+    verticesY.push_back(midY - maxWidth);
+    verticesX.push_back(midX);
+    verticesY.push_back(midY + multiplier * maxWidth);
+    verticesX.push_back(midX + multiplier * maxWidth);
+    verticesY.push_back(midY - maxWidth);
+
+    computeBoundaryTriangleTimer.stopTimer();
+
+    //  the expected number of triangles of the History DAG is at most 9n + 1, while the walk only keeps the 2n + 1
+    //  triangles of the current triangulation plus the 2 that are created before the replaced ones are freed
+    if (pointLocation == PointLocation::HistoryDAG) {
+        const size_t maxNumberOfTriangles = 9 * static_cast<size_t>(numberOfMeshVertices) + 1;
+        triangleVertices.reserve(maxNumberOfTriangles);
+        triangleNeighbors.reserve(maxNumberOfTriangles);
+        triangleChildren.reserve(maxNumberOfTriangles);
+    } else {
+        const size_t maxNumberOfTriangles = 2 * static_cast<size_t>(numberOfMeshVertices) + 4;
+        triangleVertices.reserve(maxNumberOfTriangles);
+        triangleNeighbors.reserve(maxNumberOfTriangles);
+    }
+
+    //  the bounding triangle is the root of the DAG
+    createTriangle(numberOfMeshVertices, numberOfMeshVertices + 1, numberOfMeshVertices + 2);
+}
+
+template <typename Predicates>
+TriangleIndex CompactDelaunayTriangulation<Predicates>::createTriangle(VertexIndex Pi, VertexIndex Pj, VertexIndex Pk)
+{
+    TriangleIndex triangle;
+
+    if (!freeTriangles.empty()) {
+        triangle = freeTriangles.back();
+        freeTriangles.pop_back();
+
+        triangleVertices[triangle] = {Pi, Pj, Pk};
+        triangleNeighbors[triangle] = {NO_NEIGHBOR, NO_NEIGHBOR, NO_NEIGHBOR};
+    } else {
+        triangle = static_cast<TriangleIndex>(triangleVertices.size());
+
+        triangleVertices.push_back({Pi, Pj, Pk});
+        triangleNeighbors.push_back({NO_NEIGHBOR, NO_NEIGHBOR, NO_NEIGHBOR});
+        if (pointLocation == PointLocation::HistoryDAG) {
+            triangleChildren.push_back({NO_CHILD, NO_CHILD, NO_CHILD});
+        }
+    }
+    lastCreatedTriangle = triangle;
+
+    return triangle;
+}
+
+template <typename Predicates>
+void CompactDelaunayTriangulation<Predicates>::replaceTriangle(TriangleIndex triangle,
+                                                               const std::array<TriangleIndex, 3>& children)
+{
+    if (pointLocation == PointLocation::HistoryDAG) {
+        triangleChildren[triangle] = children;
+    } else {
+        triangleVertices[triangle] = {NO_VERTEX, NO_VERTEX, NO_VERTEX};
+        freeTriangles.push_back(triangle);
+    }
+}
+
+template <typename Predicates>
+void CompactDelaunayTriangulation<Predicates>::setNeighbor(TriangleIndex triangle, int edgeId, TriangleIndex neighbor)
+{
+    triangleNeighbors[triangle][edgeId] = neighbor;
+    if (neighbor != NO_NEIGHBOR) {
+        triangleNeighbors[neighborTriangle(neighbor)][neighborEdgeId(neighbor)] = neighborCode(triangle, edgeId);
+    }
+}
+
+template <typename Predicates>
+bool CompactDelaunayTriangulation<Predicates>::inTriangle(TriangleIndex triangle, VertexIndex vertex,
+                                                          std::array<double, 3>& orientationTests) const
+{
+    const auto& vertices = triangleVertices[triangle];
+
+    const double pa[2] = {verticesX[vertices[0]], verticesY[vertices[0]]};
+    const double pb[2] = {verticesX[vertices[1]], verticesY[vertices[1]]};
+    const double pc[2] = {verticesX[vertices[2]], verticesY[vertices[2]]};
+    const double pd[2] = {verticesX[vertex], verticesY[vertex]};
+
+    return GeometricPredicates::inTriangle<Predicates>(pa, pb, pc, pd, orientationTests);
+}
+
+template <typename Predicates>
+TriangleIndex CompactDelaunayTriangulation<Predicates>::locateTriangle(VertexIndex vertex,
+                                                                       std::array<double, 3>& orientationTests) const
+{
+    //  the root of the DAG is the bounding triangle
+    TriangleIndex triangle = 0;
+
+    while (triangleChildren[triangle][0] != NO_CHILD) {
+        const auto& children = triangleChildren[triangle];
+        if (inTriangle(children[0], vertex, orientationTests)) {
+            triangle = children[0];
+        } else if (children[2] == NO_CHILD || inTriangle(children[1], vertex, orientationTests)) {
+            triangle = children[1];
+        } else {
+            triangle = children[2];
+        }
+    }
+
+    //  This is mandatory to be executed because orientationTests array has to be updated
+    //  for the case where a point falls on an edge of a triangle.
+    inTriangle(triangle, vertex, orientationTests);
+
+    return triangle;
+}
+
+template <typename Predicates>
+TriangleIndex CompactDelaunayTriangulation<Predicates>::walkToTriangle(VertexIndex vertex,
+                                                                      std::array<double, 3>& orientationTests)
+{
+    const double pd[2] = {verticesX[vertex], verticesY[vertex]};
+
+    TriangleIndex triangle = lastCreatedTriangle;
+    TriangleIndex previousTriangle = NO_NEIGHBOR;
+
+    bool walking = true;
+    while (walking) {
+        walking = false;
+
+        const int firstEdgeId = static_cast<int>(walkRandomGenerator() % 3);
+        for (int i = 0; i < 3; ++i) {
+            const int edgeId = (firstEdgeId + i) % 3;
+            const TriangleIndex neighbor = triangleNeighbors[triangle][edgeId];
+
+            //  the edges of the bounding triangle are never crossed, the edge we came from is already tested
+            if (neighbor == NO_NEIGHBOR || neighborTriangle(neighbor) == previousTriangle) {
+                continue;
+            }
+
+            const VertexIndex Pi = triangleVertices[triangle][edgeId];
+            const VertexIndex Pj = triangleVertices[triangle][plus1mod3[edgeId]];
+            const double pi[2] = {verticesX[Pi], verticesY[Pi]};
+            const double pj[2] = {verticesX[Pj], verticesY[Pj]};
+
+            //  triangles are clockwise, therefore the vertex is beyond PiPj if it lies on the left of PiPj
+            if (Predicates::orientation(pi, pj, pd) > 0) {
+                previousTriangle = triangle;
+                triangle = neighborTriangle(neighbor);
+                walking = true;
+                break;
+            }
+        }
+    }
+
+    //  This is mandatory to be executed because orientationTests array has to be updated
+    //  for the case where a point falls on an edge of a triangle.
+    inTriangle(triangle, vertex, orientationTests);
+
+    return triangle;
+}
+
+template <typename Predicates>
+void CompactDelaunayTriangulation<Predicates>::legalizeEdge(TriangleIndex PiPjPr, int edgeId)
+{
+    const TriangleIndex neighbor = triangleNeighbors[PiPjPr][edgeId];
+
+    if (neighbor != NO_NEIGHBOR) {
+        /*
+         *                                  Pk
+         *                                  /\
+         *                                 /  \
+         *                                /    \
+         *                               /      \
+         *                              /        \
+         *                             /          \
+         *                            /            \
+         *                           /              \
+         *                        Pi ---------------- Pj
+         *                            \            /
+         *                             \          /
+         *                              \        /
+         *                               \      /
+         *                                \    /
+         *                                 \  /
+         *                                  \/
+         *                                  Pr
+         */
+
+        //  find adjacent triangle of edge PiPj, whose edge PjPi has id neighborEdgeId
+        const TriangleIndex PiPkPj = neighborTriangle(neighbor);
+        const int PjPiId = neighborEdgeId(neighbor);
+
+        const VertexIndex Pi = triangleVertices[PiPjPr][edgeId];
+        const VertexIndex Pj = triangleVertices[PiPjPr][plus1mod3[edgeId]];
+        const VertexIndex Pr = triangleVertices[PiPjPr][minus1mod3[edgeId]];
+        const VertexIndex Pk = triangleVertices[PiPkPj][minus1mod3[PjPiId]];
+
+        const double pi[2] = {verticesX[Pi], verticesY[Pi]};
+        const double pj[2] = {verticesX[Pj], verticesY[Pj]};
+        const double pr[2] = {verticesX[Pr], verticesY[Pr]};
+        const double pk[2] = {verticesX[Pk], verticesY[Pk]};
+
+        //  Check if PiPj is illegal
+        if (Predicates::inCircle(pi, pj, pr, pk)) {
+            ////////////////////////////////////////////////////////////////
+            //                      Flip Edge Started                     //
+            ////////////////////////////////////////////////////////////////
+            ++numberOfFlips;
+
+            //  Find neighbors of PiPjPr and PiPkPj
+            const TriangleIndex PjPrNeighbor = triangleNeighbors[PiPjPr][plus1mod3[edgeId]];
+            const TriangleIndex PrPiNeighbor = triangleNeighbors[PiPjPr][minus1mod3[edgeId]];
+
+            const TriangleIndex PiPkNeighbor = triangleNeighbors[PiPkPj][plus1mod3[PjPiId]];
+            const TriangleIndex PkPjNeighbor = triangleNeighbors[PiPkPj][minus1mod3[PjPiId]];
+
+            //  create the new triangles
+            const TriangleIndex PiPkPr = createTriangle(Pi, Pk, Pr);
+            const TriangleIndex PkPjPr = createTriangle(Pk, Pj, Pr);
+
+            //  assign neighbors of PiPkPr
+            setNeighbor(PiPkPr, 0, PiPkNeighbor);
+            setNeighbor(PiPkPr, 1, neighborCode(PkPjPr, 2));
+            setNeighbor(PiPkPr, 2, PrPiNeighbor);
+
+            //  assign neighbors of PkPjPr
+            setNeighbor(PkPjPr, 0, PkPjNeighbor);
+            setNeighbor(PkPjPr, 1, PjPrNeighbor);
+
+            // update the DAG
+            replaceTriangle(PiPkPj, {PiPkPr, PkPjPr, NO_CHILD});
+            replaceTriangle(PiPjPr, {PiPkPr, PkPjPr, NO_CHILD});
+
+            ////////////////////////////////////////////////////////////////
+            //                       Flip Edge Ended                      //
+            ////////////////////////////////////////////////////////////////
+
+            legalizeEdge(PiPkPr, 0);
+            legalizeEdge(PkPjPr, 0);
+        }
+    }
+}
+
+template <typename Predicates>
+void CompactDelaunayTriangulation<Predicates>::generateMesh()
+{
+    createBoundingTriangle();
+
+    std::cout << std::endl << "Compute Delaunay Triangulation..." << std::endl;
+
+    meshingTimer.startTimer();
+    numberOfFlips = 0;
+
+    //  iterate over the vertices and insert them in the current triangulation. Cost: O(n)
+    for (VertexIndex Pr = 0; Pr < numberOfMeshVertices; ++Pr) {
+        //  locate a triangle that includes Pr. Cost: O(log n) with the DAG
+        std::array<double, 3> orientationTests{};
+        const TriangleIndex PiPjPk = pointLocation == PointLocation::HistoryDAG ?
+                                     locateTriangle(Pr, orientationTests) : walkToTriangle(Pr, orientationTests);
+
+        //  check if the vertex Pr lies on one of the edges of the bad triangle
+        int edgeId;
+        if (orientationTests[0] == 0) { //  lies on first edge
+            edgeId = 0;
+        } else if (orientationTests[1] == 0) {  //  lies on second edge
+            edgeId = 1;
+        } else if (orientationTests[2] == 0) {  //  lies on third edge
+            edgeId = 2;
+        } else {    //  does not lie on any edge
+            edgeId = -1;
+        }
+
+        if (edgeId == -1) { //  if vertex Pr lies in the interior of the triangle
+            /*
+             *                        Pi ---------------- Pj
+             *                            \            /
+             *                             \          /
+             *                              \   Pr   /
+             *                               \      /
+             *                                \    /
+             *                                 \  /
+             *                                  \/
+             *                                  Pk
+             */
+
+            const auto [Pi, Pj, Pk] = triangleVertices[PiPjPk];
+            const auto [PiPjNeighbor, PjPkNeighbor, PkPiNeighbor] = triangleNeighbors[PiPjPk];
+
+            ////////////////////////////////////////////////////////////////
+            //                    Split Triangle Started                  //
+            ////////////////////////////////////////////////////////////////
+
+            //  create the new triangles
+            const TriangleIndex PiPjPr = createTriangle(Pi, Pj, Pr);
+            const TriangleIndex PjPkPr = createTriangle(Pj, Pk, Pr);
+            const TriangleIndex PkPiPr = createTriangle(Pk, Pi, Pr);
+
+            //  assign neighbors of PiPjPr
+            setNeighbor(PiPjPr, 0, PiPjNeighbor);
+            setNeighbor(PiPjPr, 1, neighborCode(PjPkPr, 2));
+            setNeighbor(PiPjPr, 2, neighborCode(PkPiPr, 1));
+
+            //  assign neighbors of PjPkPr
+            setNeighbor(PjPkPr, 0, PjPkNeighbor);
+            setNeighbor(PjPkPr, 1, neighborCode(PkPiPr, 2));
+
+            //  assign neighbors of PkPiPr
+            setNeighbor(PkPiPr, 0, PkPiNeighbor);
+
+            // update the DAG
+            replaceTriangle(PiPjPk, {PiPjPr, PjPkPr, PkPiPr});
+
+            ////////////////////////////////////////////////////////////////
+            //                    Split Triangle ended                    //
+            ////////////////////////////////////////////////////////////////
+
+            //  legalize the edges of PiPjPk
+            legalizeEdge(PiPjPr, 0);
+            legalizeEdge(PjPkPr, 0);
+            legalizeEdge(PkPiPr, 0);
+        } else {    //  if vertex lies on an edge
+            /*
+             *                                  Pm
+             *                                  /\
+             *                                 /  \
+             *                                /    \
+             *                               /      \
+             *                              /        \
+             *                             /          \
+             *                            /            \
+             *                           /              \
+             *                        Pi -------Pr------- Pj
+             *                            \            /
+             *                             \          /
+             *                              \        /
+             *                               \      /
+             *                                \    /
+             *                                 \  /
+             *                                  \/
+             *                                  Pk
+             */
+
+            //  retrieve information from PiPjPk, where PiPj is its edgeId-th edge
+            const VertexIndex Pi = triangleVertices[PiPjPk][edgeId];
+            const VertexIndex Pj = triangleVertices[PiPjPk][plus1mod3[edgeId]];
+            const VertexIndex Pk = triangleVertices[PiPjPk][minus1mod3[edgeId]];
+            const TriangleIndex PjPkNeighbor = triangleNeighbors[PiPjPk][plus1mod3[edgeId]];
+            const TriangleIndex PkPiNeighbor = triangleNeighbors[PiPjPk][minus1mod3[edgeId]];
+
+            //  retrieve information from PiPmPj, whose edge PjPi has id PjPiId
+            const TriangleIndex neighbor = triangleNeighbors[PiPjPk][edgeId];
+            const TriangleIndex PiPmPj = neighborTriangle(neighbor);
+            const int PjPiId = neighborEdgeId(neighbor);
+            const VertexIndex Pm = triangleVertices[PiPmPj][minus1mod3[PjPiId]];
+            const TriangleIndex PiPmNeighbor = triangleNeighbors[PiPmPj][plus1mod3[PjPiId]];
+            const TriangleIndex PmPjNeighbor = triangleNeighbors[PiPmPj][minus1mod3[PjPiId]];
+
+            ////////////////////////////////////////////////////////////////
+            //                   Split Triangles Started                  //
+            ////////////////////////////////////////////////////////////////
+
+            //  create the new triangles
+            const TriangleIndex PiPmPr = createTriangle(Pi, Pm, Pr);
+            const TriangleIndex PmPjPr = createTriangle(Pm, Pj, Pr);
+            const TriangleIndex PjPkPr = createTriangle(Pj, Pk, Pr);
+            const TriangleIndex PkPiPr = createTriangle(Pk, Pi, Pr);
+
+            //  assign neighbors of PiPmPr
+            setNeighbor(PiPmPr, 0, PiPmNeighbor);
+            setNeighbor(PiPmPr, 1, neighborCode(PmPjPr, 2));
+            setNeighbor(PiPmPr, 2, neighborCode(PkPiPr, 1));
+
+            //  assign neighbors of PmPjPr
+            setNeighbor(PmPjPr, 0, PmPjNeighbor);
+            setNeighbor(PmPjPr, 1, neighborCode(PjPkPr, 2));
+
+            //  assign neighbors of PjPkPr
+            setNeighbor(PjPkPr, 0, PjPkNeighbor);
+            setNeighbor(PjPkPr, 1, neighborCode(PkPiPr, 2));
+
+            //  assign neighbors of PkPiPr
+            setNeighbor(PkPiPr, 0, PkPiNeighbor);
+
+            // update the DAG
+            replaceTriangle(PiPmPj, {PiPmPr, PmPjPr, NO_CHILD});
+            replaceTriangle(PiPjPk, {PjPkPr, PkPiPr, NO_CHILD});
+
+            ////////////////////////////////////////////////////////////////
+            //                   Split Triangles Ended                    //
+            ////////////////////////////////////////////////////////////////
+
+            legalizeEdge(PiPmPr, 0);
+            legalizeEdge(PmPjPr, 0);
+            legalizeEdge(PjPkPr, 0);
+            legalizeEdge(PkPiPr, 0);
+        }
+    }
+
+    createOutputMesh();
+
+    std::cout << std::endl << "Mesh Vertices: " << outputMesh.verticesX.size() << std::endl;
+    std::cout << "Mesh Triangles: " << outputMesh.triangles.size() << std::endl;
+
+    meshingTimer.stopTimer();
+}
+
+template <typename Predicates>
+void CompactDelaunayTriangulation<Predicates>::createOutputMesh()
+{
+    std::cout << std::endl << "Compute Mesh Results..." << std::endl;
+
+    outputMesh = Mesh();
+
+    //  the leaves of the DAG that do not contain a vertex of the bounding triangle form the triangulation.
+    //  Freed slots of the walk are skipped as well, because NO_VERTEX is not a vertex of the mesh.
+    for (size_t triangle = 0; triangle < triangleVertices.size(); ++triangle) {
+        const auto& vertices = triangleVertices[triangle];
+        const bool leafTriangle = pointLocation == PointLocation::Walk || triangleChildren[triangle][0] == NO_CHILD;
+        if (leafTriangle && vertices[0] < numberOfMeshVertices &&
+            vertices[1] < numberOfMeshVertices && vertices[2] < numberOfMeshVertices) {
+            outputMesh.triangles.push_back(vertices);
+        }
+    }
+
+    //  the DAG is no longer needed. Assigning {} would keep the capacity, so empty vectors are moved in.
+    triangleVertices = std::vector<std::array<VertexIndex, 3>>();
+    triangleNeighbors = std::vector<std::array<TriangleIndex, 3>>();
+    triangleChildren = std::vector<std::array<TriangleIndex, 3>>();
+    freeTriangles = std::vector<TriangleIndex>();
+
+    //  hand over the input vertices, without the bounding triangle
+    verticesX.resize(numberOfMeshVertices);
+    verticesY.resize(numberOfMeshVertices);
+    outputMesh.verticesX = std::move(verticesX);
+    outputMesh.verticesY = std::move(verticesY);
+    outputMesh.inputPositions = std::move(inputPositions);
+    inputPositions = std::vector<VertexIndex>();
+
+    MemoryUsage::releaseFreeMemory();
+}
+
+template class CompactDelaunayTriangulation<GeometricPredicates::Fast>;
+template class CompactDelaunayTriangulation<GeometricPredicates::Filtered>;
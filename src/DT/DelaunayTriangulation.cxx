@@ -8,55 +8,50 @@
  */
 
 #include <algorithm>
-#include <random>
 #include "DelaunayTriangulation.hxx"
+#include "MemoryUsage.hxx"
 
 
-DelaunayTriangulation::DelaunayTriangulation(bool robustPredicates) : HistoryDAG()
+//  Fast lookup arrays to speed up the mesh manipulation primitives
+static constexpr int plus1mod3[3] = {1, 2, 0};
+static constexpr int minus1mod3[3] = {2, 0, 1};
+
+template <typename Predicates>
+DelaunayTriangulation<Predicates>::DelaunayTriangulation(PointLocation pointLocation,
+                                                         InsertionOrder insertionOrder)
+        : Triangulation(Predicates::robust), HistoryDAG(), pointLocation(pointLocation), insertionOrder(insertionOrder)
 {
-    GeometricPredicates::initialize(robustPredicates);
 }
 
-DelaunayTriangulation::~DelaunayTriangulation()
+template <typename Predicates>
+DelaunayTriangulation<Predicates>::~DelaunayTriangulation()
 {
-    for (auto& vertex : meshVertices) {
-        delete vertex;
-    }
-    meshVertices.clear();
-
-    for (auto& triangle : meshTriangles) {
-        delete triangle;
-    }
-    meshTriangles.clear();
+    releaseTriangulation();
 }
 
-void DelaunayTriangulation::setInputVertices(std::vector<Vertex>& vertices)
+template <typename Predicates>
+void DelaunayTriangulation<Predicates>::setInputVertices(std::vector<Vertex>& vertices, unsigned numberOfThreads)
 {
-    std::cout << std::endl << "Sort lexicographically, Remove duplicates, and Shuffle Vertices..."
-              << std::endl;
+    removeDuplicatesAndShuffle(vertices, insertionOrder, numberOfThreads);
 
-    //  sort vertices lexicographically in descending order. Cost: O(n log n)
-    std::sort(vertices.begin(), vertices.end(), std::greater<>());
+    //  forget the triangulation of a previous run
+    releaseTriangulation();
 
-    //  remove duplicate vertices. Cost: O(n)
-    vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
-
-    //  compute a random permutation of the vertices
-    //  Note: if shuffle is not activated, the complexity of the algorithm becomes: O(n^2).
-    auto randomGenerator = std::default_random_engine(std::random_device{}());
-    std::shuffle(vertices.begin(), vertices.end(), randomGenerator);
-
-    meshVertices.clear();
+    meshVertices.reserve(vertices.size());
+    inputPositions.clear();
+    inputPositions.reserve(vertices.size());
     //  extract unique vertices. Cost O(n)
     for (size_t i = 0; i < vertices.size(); ++i) {
-        auto vertex = new Vertex(vertices[i]);
+        inputPositions.push_back(static_cast<VertexIndex>(vertices[i].id));
+        auto vertex = vertexPool.create(vertices[i]);
         vertex->id = static_cast<int>(i + 1);
         meshVertices.push_back(vertex);
     }
     vertices.clear();
 }
 
-void DelaunayTriangulation::createBoundingTriangle()
+template <typename Predicates>
+void DelaunayTriangulation<Predicates>::createBoundingTriangle()
 {
     std::cout << std::endl << "Compute Bounding Triangle..." << std::endl;
 
@@ -87,33 +82,121 @@ void DelaunayTriangulation::createBoundingTriangle()
     const double maxWidth = std::max(maxX - minX, maxY - minY);
     const double multiplier = 100.0;
 
-    auto Pi = new Vertex({midX - multiplier * maxWidth, midY - maxWidth});
+    auto Pi = vertexPool.create(std::array<double, 2>{midX - multiplier * maxWidth, midY - maxWidth});
     Pi->id = -3;
-    auto Pj = new Vertex({midX, midY + multiplier * maxWidth});
+    auto Pj = vertexPool.create(std::array<double, 2>{midX, midY + multiplier * maxWidth});
     Pj->id = -2;
-    auto Pk = new Vertex({midX + multiplier * maxWidth, midY - maxWidth});
+    auto Pk = vertexPool.create(std::array<double, 2>{midX + multiplier * maxWidth, midY - maxWidth});
     Pk->id = -1;
 
-    auto PiPj = new Edge();
-    auto PjPk = new Edge();
-    auto PkPi = new Edge();
-
     computeBoundaryTriangleTimer.stopTimer();
 
-    auto PiPjPk = new Triangle({Pi, Pj, Pk});
-    PiPjPk->setEdges({PiPj, PjPk, PkPi});
+    //  the edges of the bounding triangle are boundary edges, therefore it has no neighbors
+    //  in DAG, the bounding triangle is the first created triangle, therefore it is the root
+    if (pointLocation == PointLocation::HistoryDAG) {
+        reserve(meshVertices.size());
+    }
+    createTriangle(Pi, Pj, Pk);
+}
+
+template <typename Predicates>
+TriangleHandle DelaunayTriangulation<Predicates>::createTriangle(const VertexHandle& Pi, const VertexHandle& Pj,
+                                                                 const VertexHandle& Pk)
+{
+    lastCreatedTriangle = trianglePool.create(std::array<VertexHandle, 3>{Pi, Pj, Pk});
+    if (pointLocation == PointLocation::HistoryDAG) {
+        lastCreatedTriangle->dagNode = addTriangle(lastCreatedTriangle);
+    }
+
+    return lastCreatedTriangle;
+}
+
+template <typename Predicates>
+void DelaunayTriangulation<Predicates>::replaceTriangle(const TriangleHandle& triangle,
+                                                        const std::array<TriangleHandle, 3>& children)
+{
+    //  the DAG keeps the coordinates of the triangle in its node, therefore the triangle itself is not needed
+    if (pointLocation == PointLocation::HistoryDAG) {
+        addChildTriangles(triangle, children);
+    }
+    trianglePool.recycle(triangle);
+}
+
+template <typename Predicates>
+TriangleHandle DelaunayTriangulation<Predicates>::walkToTriangle(const VertexHandle& vertex,
+                                                                 std::array<double, 3>& orientationTests)
+{
+    TriangleHandle triangle = lastCreatedTriangle;
+    TriangleHandle previousTriangle = nullptr;
+
+    bool walking = true;
+    while (walking) {
+        walking = false;
+
+        const int firstEdgeId = static_cast<int>(walkRandomGenerator() % 3);
+        for (int i = 0; i < 3; ++i) {
+            const int edgeId = (firstEdgeId + i) % 3;
+            const TriangleHandle neighbor = triangle->neighbors[edgeId];
+
+            //  the edges of the bounding triangle are never crossed, the edge we came from is already tested
+            if (neighbor == nullptr || neighbor == previousTriangle) {
+                continue;
+            }
+
+            //  triangles are clockwise, therefore the vertex is beyond PiPj if it lies on the left of PiPj
+            if (Predicates::orientation(triangle->vertices[edgeId]->coordinates,
+                                        triangle->vertices[plus1mod3[edgeId]]->coordinates,
+                                        vertex->coordinates) > 0) {
+                previousTriangle = triangle;
+                triangle = neighbor;
+                walking = true;
+                break;
+            }
+        }
+    }
+
+    //  This is mandatory to be executed because orientationTests array has to be updated
+    //  for the case where a point falls on an edge of a triangle.
+    GeometricPredicates::inTriangle<Predicates>(triangle, vertex, orientationTests);
+
+    return triangle;
+}
+
+template <typename Predicates>
+std::vector<TriangleHandle> DelaunayTriangulation<Predicates>::extractTriangulationFromNeighbors()
+{
+    std::cout << std::endl << "Compute Mesh Results..." << std::endl;
+
+    std::vector<TriangleHandle> triangles;
+    triangles.reserve(2 * meshVertices.size());
+
+    //  depth first traversal of the current triangulation
+    std::vector<TriangleHandle> stack{lastCreatedTriangle};
+    lastCreatedTriangle->visitedTriangle = true;
+    while (!stack.empty()) {
+        TriangleHandle triangle = stack.back();
+        stack.pop_back();
+
+        //  bounding triangle vertices have negative ids
+        if (triangle->vertices[0]->id > 0 && triangle->vertices[1]->id > 0 && triangle->vertices[2]->id > 0) {
+            triangles.push_back(triangle);
+        }
 
-    PiPj->addAdjacentTriangle(TrianglePair(PiPjPk, 0));
-    PjPk->addAdjacentTriangle(TrianglePair(PiPjPk, 1));
-    PkPi->addAdjacentTriangle(TrianglePair(PiPjPk, 2));
+        for (auto& neighbor : triangle->neighbors) {
+            if (neighbor != nullptr && !neighbor->visitedTriangle) {
+                neighbor->visitedTriangle = true;
+                stack.push_back(neighbor);
+            }
+        }
+    }
 
-    //  initialize root triangle of DAG
-    setRootTriangle(PiPjPk);
+    return triangles;
 }
 
-void DelaunayTriangulation::legalizeEdge(EdgeHandle& PiPj, const VertexHandle& Pr)
+template <typename Predicates>
+void DelaunayTriangulation<Predicates>::legalizeEdge(const TriangleHandle& PiPjPr, int edgeId)
 {
-    if (!PiPj->isBoundaryEdge()) {
+    if (PiPjPr->neighbors[edgeId] != nullptr) {
         /*
          *                                  Pk
          *                                  /\
@@ -135,76 +218,59 @@ void DelaunayTriangulation::legalizeEdge(EdgeHandle& PiPj, const VertexHandle& P
          *                                  Pr
          */
 
-        //  find adjacent triangles of edge PiPj
-        auto PiPjPr = PiPj->getLeftTriangle();
-        auto Pk = PiPj->getDestinationVertexRightTriangle();
+        //  find adjacent triangle of edge PiPj, in which PjPi is the PjPiId-th edge
+        auto PiPkPj = PiPjPr->neighbors[edgeId];
+        int PjPiId = PiPjPr->neighborEdgeIds[edgeId];
+        auto Pk = PiPkPj->vertices[minus1mod3[PjPiId]];
 
         //  Check if PiPj is illegal
-        if (GeometricPredicates::inCircle(PiPjPr, Pk)) {
+        if (GeometricPredicates::inCircle<Predicates>(PiPjPr, Pk)) {
             ////////////////////////////////////////////////////////////////
             //                      Flip Edge Started                     //
             ////////////////////////////////////////////////////////////////
+            ++numberOfFlips;
 
-            auto PiPkPj = PiPj->getRightTriangle();
-
-            //  Find vertices and edges of PiPjPr and PiPkPj
-            auto Pi = PiPj->getOriginVertexLeftTriangle();
-            auto Pj = PiPj->getDestinationVertexLeftTriangle();
-
-            auto PjPr = PiPj->getDestinationEdgeLeftTriangle();
-            auto PrPi = PiPj->getApexEdgeLeftTriangle();
-
-            auto PiPk = PiPj->getOriginEdgeRightTriangle();
-            auto PkPj = PiPj->getDestinationEdgeRightTriangle();
-
-            //  remove the PiPj edge because we are gonna flip it
-            delete PiPj;
+            //  Find vertices of PiPjPr
+            auto Pi = PiPjPr->vertices[edgeId];
+            auto Pj = PiPjPr->vertices[plus1mod3[edgeId]];
+            auto Pr = PiPjPr->vertices[minus1mod3[edgeId]];
 
             //  create the new triangles
-            auto PiPkPr = new Triangle({Pi, Pk, Pr});
-            auto PkPjPr = new Triangle({Pk, Pj, Pr});
-
-            //  create the new edge for the new triangles
-            auto PkPr = new Edge();
-
-            //  assign adjacent triangles of the PiPkPr edges
-            PiPk->replaceAdjacentTriangle(PiPkPj, TrianglePair(PiPkPr, 0));
-            PkPr->addAdjacentTriangle(TrianglePair(PiPkPr, 1));
-            PrPi->replaceAdjacentTriangle(PiPjPr, TrianglePair(PiPkPr, 2));
+            auto PiPkPr = createTriangle(Pi, Pk, Pr);
+            auto PkPjPr = createTriangle(Pk, Pj, Pr);
 
-            //  assign adjacent triangles of the PkPjPr edges
-            PkPj->replaceAdjacentTriangle(PiPkPj, TrianglePair(PkPjPr, 0));
-            PjPr->replaceAdjacentTriangle(PiPjPr, TrianglePair(PkPjPr, 1));
-            PkPr->addAdjacentTriangle(TrianglePair(PkPjPr, 2));
+            //  assign neighbors of PiPkPr
+            PiPkPr->setNeighbor(0, PiPkPj->neighbors[plus1mod3[PjPiId]], PiPkPj->neighborEdgeIds[plus1mod3[PjPiId]]);
+            PiPkPr->setNeighbor(1, PkPjPr, 2);
+            PiPkPr->setNeighbor(2, PiPjPr->neighbors[minus1mod3[edgeId]], PiPjPr->neighborEdgeIds[minus1mod3[edgeId]]);
 
-            //  set edges of PiPkPr and PkPjPr
-            PiPkPr->setEdges({PiPk, PkPr, PrPi});
-            PkPjPr->setEdges({PkPj, PjPr, PkPr});
+            //  assign neighbors of PkPjPr
+            PkPjPr->setNeighbor(0, PiPkPj->neighbors[minus1mod3[PjPiId]], PiPkPj->neighborEdgeIds[minus1mod3[PjPiId]]);
+            PkPjPr->setNeighbor(1, PiPjPr->neighbors[plus1mod3[edgeId]], PiPjPr->neighborEdgeIds[plus1mod3[edgeId]]);
 
             // update the DAG
-            PiPkPj->childrenTriangles.push_back(PiPkPr);
-            PiPkPj->childrenTriangles.push_back(PkPjPr);
-
-            PiPjPr->childrenTriangles.push_back(PiPkPr);
-            PiPjPr->childrenTriangles.push_back(PkPjPr);
+            replaceTriangle(PiPkPj, {PiPkPr, PkPjPr, nullptr});
+            replaceTriangle(PiPjPr, {PiPkPr, PkPjPr, nullptr});
 
             ////////////////////////////////////////////////////////////////
             //                       Flip Edge Ended                      //
             ////////////////////////////////////////////////////////////////
 
-            legalizeEdge(PiPk, Pr);
-            legalizeEdge(PkPj, Pr);
+            legalizeEdge(PiPkPr, 0);
+            legalizeEdge(PkPjPr, 0);
         }
     }
 }
 
-void DelaunayTriangulation::generateMesh()
+template <typename Predicates>
+void DelaunayTriangulation<Predicates>::generateMesh()
 {
     createBoundingTriangle();
 
     std::cout << std::endl << "Compute Delaunay Triangulation..." << std::endl;
 
     meshingTimer.startTimer();
+    numberOfFlips = 0;
 
     //  iterate over the meshVertices and insert them in the current triangulation. Cost: O(n)
     for (auto& Pr : meshVertices) {
@@ -215,7 +281,8 @@ void DelaunayTriangulation::generateMesh()
         //  Since the max number of triangles created by this algorithm is 9n + 1,
         //  and assuming almost uniformly distributed DAG, we can say that: log(9n + 1) = O (log n)
         std::array<double, 3> orientationTests{};
-        auto PiPjPk = locateTriangle(Pr, orientationTests);
+        auto PiPjPk = pointLocation == PointLocation::HistoryDAG ?
+                      locateTriangle<Predicates>(Pr, orientationTests) : walkToTriangle(Pr, orientationTests);
 
         //  check if the vertex Pr lies on one of the edges of the bad triangle
         int edgeId;
@@ -246,57 +313,38 @@ void DelaunayTriangulation::generateMesh()
             auto Pj = PiPjPk->vertices[1];
             auto Pk = PiPjPk->vertices[2];
 
-            auto PiPj = PiPjPk->edges[0];
-            auto PjPk = PiPjPk->edges[1];
-            auto PkPi = PiPjPk->edges[2];
-
             ////////////////////////////////////////////////////////////////
             //                    Split Triangle Started                  //
             ////////////////////////////////////////////////////////////////
 
             //  create the new triangles
-            auto PiPjPr = new Triangle({Pi, Pj, Pr});
-            auto PjPkPr = new Triangle({Pj, Pk, Pr});
-            auto PkPiPr = new Triangle({Pk, Pi, Pr});
-
-            //  create the new edges for the new triangles
-            auto PiPr = new Edge();
-            auto PjPr = new Edge();
-            auto PkPr = new Edge();
-
-            //  assign adjacent triangles of the PiPjPr Edges
-            PiPj->replaceAdjacentTriangle(PiPjPk, TrianglePair(PiPjPr, 0));
-            PjPr->addAdjacentTriangle(TrianglePair(PiPjPr, 1));
-            PiPr->addAdjacentTriangle(TrianglePair(PiPjPr, 2));
-
-            //  assign adjacent triangles of the PjPkPr Edges
-            PjPk->replaceAdjacentTriangle(PiPjPk, TrianglePair(PjPkPr, 0));
-            PkPr->addAdjacentTriangle(TrianglePair(PjPkPr, 1));
-            PjPr->addAdjacentTriangle(TrianglePair(PjPkPr, 2));
-
-            //  assign adjacent triangles of the PkPiPr Edges
-            PkPi->replaceAdjacentTriangle(PiPjPk, TrianglePair(PkPiPr, 0));
-            PiPr->addAdjacentTriangle(TrianglePair(PkPiPr, 1));
-            PkPr->addAdjacentTriangle(TrianglePair(PkPiPr, 2));
-
-            //  set edges of PiPjPr, PjPkPr and PkPiPr
-            PiPjPr->setEdges({PiPj, PjPr, PiPr});
-            PjPkPr->setEdges({PjPk, PkPr, PjPr});
-            PkPiPr->setEdges({PkPi, PiPr, PkPr});
+            auto PiPjPr = createTriangle(Pi, Pj, Pr);
+            auto PjPkPr = createTriangle(Pj, Pk, Pr);
+            auto PkPiPr = createTriangle(Pk, Pi, Pr);
+
+            //  assign neighbors of PiPjPr
+            PiPjPr->setNeighbor(0, PiPjPk->neighbors[0], PiPjPk->neighborEdgeIds[0]);
+            PiPjPr->setNeighbor(1, PjPkPr, 2);
+            PiPjPr->setNeighbor(2, PkPiPr, 1);
+
+            //  assign neighbors of PjPkPr
+            PjPkPr->setNeighbor(0, PiPjPk->neighbors[1], PiPjPk->neighborEdgeIds[1]);
+            PjPkPr->setNeighbor(1, PkPiPr, 2);
+
+            //  assign neighbors of PkPiPr
+            PkPiPr->setNeighbor(0, PiPjPk->neighbors[2], PiPjPk->neighborEdgeIds[2]);
 
             // update the DAG
-            PiPjPk->childrenTriangles.push_back(PiPjPr);
-            PiPjPk->childrenTriangles.push_back(PjPkPr);
-            PiPjPk->childrenTriangles.push_back(PkPiPr);
+            replaceTriangle(PiPjPk, {PiPjPr, PjPkPr, PkPiPr});
 
             ////////////////////////////////////////////////////////////////
             //                    Split Triangle ended                    //
             ////////////////////////////////////////////////////////////////
 
             //  legalize the edges of PiPjPk
-            legalizeEdge(PiPj, Pr);
-            legalizeEdge(PjPk, Pr);
-            legalizeEdge(PkPi, Pr);
+            legalizeEdge(PiPjPr, 0);
+            legalizeEdge(PjPkPr, 0);
+            legalizeEdge(PkPiPr, 0);
         } else {    //  if vertex lies on an edge
             /*
              *                                  Pm
@@ -319,138 +367,109 @@ void DelaunayTriangulation::generateMesh()
              *                                  Pk
              */
 
-            //  retrieve information from PiPjPk
-            VertexHandle Pk;
-            EdgeHandle PiPj;
-
-            //  define the above variables to treat each edge the same way
-            if (edgeId == 0) {  //  lies on first edge
-                Pk = PiPjPk->vertices[2];
-                PiPj = PiPjPk->edges[0];
-            } else if (edgeId == 1) {   //  lies on second edge
-                Pk = PiPjPk->vertices[0];
-                PiPj = PiPjPk->edges[1];
-            } else {    //  lies on third edge
-                Pk = PiPjPk->vertices[1];
-                PiPj = PiPjPk->edges[2];
-            }
-
-            PiPj->determineAdjacentTriangles(Pk->id);
+            //  retrieve information from PiPjPk, where PiPj is the edgeId-th edge
+            auto Pi = PiPjPk->vertices[edgeId];
+            auto Pj = PiPjPk->vertices[plus1mod3[edgeId]];
+            auto Pk = PiPjPk->vertices[minus1mod3[edgeId]];
 
-            auto Pi = PiPj->getOriginVertexLeftTriangle();
-            auto Pj = PiPj->getDestinationVertexLeftTriangle();
-            auto PjPk = PiPj->getDestinationEdgeLeftTriangle();
-            auto PkPi = PiPj->getApexEdgeLeftTriangle();
-
-            //  retrieve information from PiPmPj
-            auto PiPmPj = PiPj->getRightTriangle();
-            auto Pm = PiPj->getDestinationVertexRightTriangle();
-            auto PiPm = PiPj->getOriginEdgeRightTriangle();
-            auto PmPj = PiPj->getDestinationEdgeRightTriangle();
+            //  retrieve information from PiPmPj, where PjPi is the PjPiId-th edge
+            auto PiPmPj = PiPjPk->neighbors[edgeId];
+            int PjPiId = PiPjPk->neighborEdgeIds[edgeId];
+            auto Pm = PiPmPj->vertices[minus1mod3[PjPiId]];
 
             ////////////////////////////////////////////////////////////////
             //                   Split Triangles Started                  //
             ////////////////////////////////////////////////////////////////
 
-            //  remove the bad edge PiPj
-            delete PiPj;
-
             //  create the new triangles
-            auto PiPmPr = new Triangle({Pi, Pm, Pr});
-            auto PmPjPr = new Triangle({Pm, Pj, Pr});
-            auto PjPkPr = new Triangle({Pj, Pk, Pr});
-            auto PkPiPr = new Triangle({Pk, Pi, Pr});
-
-            //  create the new edges for the new triangles
-            auto PiPr = new Edge();
-            auto PmPr = new Edge();
-            auto PjPr = new Edge();
-            auto PkPr = new Edge();
-
-            //  assign adjacent triangles of the PiPmPr Edges
-            PiPm->replaceAdjacentTriangle(PiPmPj, TrianglePair(PiPmPr, 0));
-            PmPr->addAdjacentTriangle(TrianglePair(PiPmPr, 1));
-            PiPr->addAdjacentTriangle(TrianglePair(PiPmPr, 2));
-
-            //  assign adjacent triangles of the PmPjPr Edges
-            PmPj->replaceAdjacentTriangle(PiPmPj, TrianglePair(PmPjPr, 0));
-            PjPr->addAdjacentTriangle(TrianglePair(PmPjPr, 1));
-            PmPr->addAdjacentTriangle(TrianglePair(PmPjPr, 2));
-
-            //  assign adjacent triangles of the PjPkPr Edges
-            PjPk->replaceAdjacentTriangle(PiPjPk, TrianglePair(PjPkPr, 0));
-            PkPr->addAdjacentTriangle(TrianglePair(PjPkPr, 1));
-            PjPr->addAdjacentTriangle(TrianglePair(PjPkPr, 2));
-
-            //  assign adjacent triangles of the PkPiPr edges
-            PkPi->replaceAdjacentTriangle(PiPjPk, TrianglePair(PkPiPr, 0));
-            PiPr->addAdjacentTriangle(TrianglePair(PkPiPr, 1));
-            PkPr->addAdjacentTriangle(TrianglePair(PkPiPr, 2));
-
-            //  set edges of new triangles
-            PiPmPr->setEdges({PiPm, PmPr, PiPr});
-            PmPjPr->setEdges({PmPj, PjPr, PmPr});
-            PjPkPr->setEdges({PjPk, PkPr, PjPr});
-            PkPiPr->setEdges({PkPi, PiPr, PkPr});
+            auto PiPmPr = createTriangle(Pi, Pm, Pr);
+            auto PmPjPr = createTriangle(Pm, Pj, Pr);
+            auto PjPkPr = createTriangle(Pj, Pk, Pr);
+            auto PkPiPr = createTriangle(Pk, Pi, Pr);
 
-            // update the DAG
-            PiPmPj->childrenTriangles.push_back(PiPmPr);
-            PiPmPj->childrenTriangles.push_back(PmPjPr);
+            //  assign neighbors of PiPmPr
+            PiPmPr->setNeighbor(0, PiPmPj->neighbors[plus1mod3[PjPiId]], PiPmPj->neighborEdgeIds[plus1mod3[PjPiId]]);
+            PiPmPr->setNeighbor(1, PmPjPr, 2);
+            PiPmPr->setNeighbor(2, PkPiPr, 1);
+
+            //  assign neighbors of PmPjPr
+            PmPjPr->setNeighbor(0, PiPmPj->neighbors[minus1mod3[PjPiId]], PiPmPj->neighborEdgeIds[minus1mod3[PjPiId]]);
+            PmPjPr->setNeighbor(1, PjPkPr, 2);
+
+            //  assign neighbors of PjPkPr
+            PjPkPr->setNeighbor(0, PiPjPk->neighbors[plus1mod3[edgeId]], PiPjPk->neighborEdgeIds[plus1mod3[edgeId]]);
+            PjPkPr->setNeighbor(1, PkPiPr, 2);
 
-            PiPjPk->childrenTriangles.push_back(PjPkPr);
-            PiPjPk->childrenTriangles.push_back(PkPiPr);
+            //  assign neighbors of PkPiPr
+            PkPiPr->setNeighbor(0, PiPjPk->neighbors[minus1mod3[edgeId]], PiPjPk->neighborEdgeIds[minus1mod3[edgeId]]);
+
+            // update the DAG
+            replaceTriangle(PiPmPj, {PiPmPr, PmPjPr, nullptr});
+            replaceTriangle(PiPjPk, {PjPkPr, PkPiPr, nullptr});
 
             ////////////////////////////////////////////////////////////////
             //                   Split Triangles Ended                    //
             ////////////////////////////////////////////////////////////////
 
-            legalizeEdge(PiPm, Pr);
-            legalizeEdge(PmPj, Pr);
-            legalizeEdge(PjPk, Pr);
-            legalizeEdge(PkPi, Pr);
+            legalizeEdge(PiPmPr, 0);
+            legalizeEdge(PmPjPr, 0);
+            legalizeEdge(PjPkPr, 0);
+            legalizeEdge(PkPiPr, 0);
         }
     }
 
-    meshTriangles = extractTriangulationWithoutBoundingTriangle();
+    if (pointLocation == PointLocation::HistoryDAG) {
+        createOutputMesh(extractTriangulationWithoutBoundingTriangle());
+    } else {
+        createOutputMesh(extractTriangulationFromNeighbors());
+    }
 
-    std::cout << std::endl << "Mesh Vertices: " << meshVertices.size() << std::endl;
-    std::cout << "Mesh Triangles: " << meshTriangles.size() << std::endl;
+    //  the output mesh holds copies of the coordinates and vertex indices, therefore nothing else is needed
+    releaseTriangulation();
+
+    std::cout << std::endl << "Mesh Vertices: " << outputMesh.verticesX.size() << std::endl;
+    std::cout << "Mesh Triangles: " << outputMesh.triangles.size() << std::endl;
 
     meshingTimer.stopTimer();
 }
 
-void DelaunayTriangulation::validateDelaunayTriangulation()
+template <typename Predicates>
+void DelaunayTriangulation<Predicates>::releaseTriangulation()
 {
-    validateDelaunayTriangulationTimer.startTimer();
-
-    std::cout << std::endl << "Validating Delaunay property..." << std::endl;
-    bool validDelaunay = true;
-    for (auto meshTriangle : meshTriangles) {
-        for (auto meshVertex : meshVertices) {
-            if (GeometricPredicates::inCircle(meshTriangle, meshVertex)) {
-                std::cout << "Triangle: " << *meshTriangle->vertices[0] << *meshTriangle->vertices[1]
-                          << *meshTriangle->vertices[2] << " against Vertex: " << *meshVertex << " is not Delaunay."
-                          << std::endl;
-                validDelaunay = false;
-            }
-        }
-    }
+    //  the nodes of the DAG only point to triangles of the pool, so they are released together with them
+    HistoryDAG::clear();
+    lastCreatedTriangle = nullptr;
 
-    if (!validDelaunay) {
-        std::cout << std::endl << "Triangulation is not Delaunay" << std::endl;
-    } else {
-        std::cout << std::endl << "Triangulation is Delaunay" << std::endl;
-    }
+    meshVertices = std::vector<VertexHandle>();
 
-    validateDelaunayTriangulationTimer.stopTimer();
+    //  release all the vertices and triangles in bulk
+    trianglePool.release();
+    vertexPool.release();
+    MemoryUsage::releaseFreeMemory();
 }
 
-Mesh DelaunayTriangulation::getOutputMesh()
+template <typename Predicates>
+void DelaunayTriangulation<Predicates>::createOutputMesh(const std::vector<TriangleHandle>& triangles)
 {
-    Mesh mesh = Mesh();
-
-    mesh.vertices = meshVertices;
-    mesh.triangles = meshTriangles;
+    outputMesh = Mesh();
 
-    return mesh;
+    outputMesh.verticesX.reserve(meshVertices.size());
+    outputMesh.verticesY.reserve(meshVertices.size());
+    for (auto& vertex : meshVertices) {
+        outputMesh.verticesX.push_back((*vertex)[0]);
+        outputMesh.verticesY.push_back((*vertex)[1]);
+    }
+    outputMesh.inputPositions = std::move(inputPositions);
+    inputPositions = std::vector<VertexIndex>();
+
+    //  the id of each vertex is its index in meshVertices plus 1
+    outputMesh.triangles.reserve(triangles.size());
+    for (auto& triangle : triangles) {
+        outputMesh.triangles.push_back({static_cast<VertexIndex>(triangle->vertices[0]->id - 1),
+                                        static_cast<VertexIndex>(triangle->vertices[1]->id - 1),
+                                        static_cast<VertexIndex>(triangle->vertices[2]->id - 1)});
+    }
 }
+
+template class DelaunayTriangulation<GeometricPredicates::Fast>;
+template class DelaunayTriangulation<GeometricPredicates::Filtered>;
@@ -0,0 +1,455 @@
+/*
+ * Filename:    DivideAndConquerTriangulation.cxx
+ *
+ * Description: Source file of DivideAndConquerTriangulation class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include "GeometricPredicates.hxx"
+#include "DivideAndConquerTriangulation.hxx"
+#include "MemoryUsage.hxx"
+#include "ParallelSort.hxx"
+
+
+//  halves smaller than this are not worth a thread
+static constexpr VertexIndex MIN_PARALLEL_VERTICES = 1u << 14u;
+
+//  ranges of vertices or quads of the output mesh smaller than this are not worth a thread
+static constexpr size_t MIN_OUTPUT_ITEMS_PER_THREAD = 1u << 14u;
+
+/**
+ * @brief Runs a function on contiguous ranges of items, one per thread. The calling thread runs the first range.
+ *
+ * @param numberOfItems is the number of items
+ * @param numberOfRanges is the number of ranges
+ * @param function is called with the index, the first item, and the item after the last item of each range
+ */
+template <typename Function>
+static void runInRanges(size_t numberOfItems, size_t numberOfRanges, const Function& function)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfRanges - 1);
+    for (size_t range = 1; range < numberOfRanges; ++range) {
+        threads.emplace_back(function, range, range * numberOfItems / numberOfRanges,
+                             (range + 1) * numberOfItems / numberOfRanges);
+    }
+    function(0, 0, numberOfItems / numberOfRanges);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Orders two vertices along an axis. The order along x is the lexicographic one, and the order along y is the
+ * lexicographic order after a clockwise rotation by 90 degrees, i.e. of (y, -x), so that the bottom half of a
+ * horizontal cut plays the role of the left half of a vertical cut.
+ */
+static inline bool precedesAlongAxis(const std::array<double, 2>& Pa, const std::array<double, 2>& Pb, int axis)
+{
+    if (axis == 0) {
+        return Pa[0] < Pb[0] || (Pa[0] == Pb[0] && Pa[1] < Pb[1]);
+    }
+    return Pa[1] < Pb[1] || (Pa[1] == Pb[1] && Pa[0] > Pb[0]);
+}
+
+template <typename Predicates>
+DivideAndConquerTriangulation<Predicates>::DivideAndConquerTriangulation(unsigned numberOfThreads)
+        : Triangulation(Predicates::robust), numberOfThreads(std::max(numberOfThreads, 1u))
+{
+}
+
+template <typename Predicates>
+DivideAndConquerTriangulation<Predicates>::~DivideAndConquerTriangulation() = default;
+
+template <typename Predicates>
+void DivideAndConquerTriangulation<Predicates>::setInputVertices(std::vector<Vertex>& vertices, unsigned numberOfThreads)
+{
+    std::cout << std::endl << "Sort lexicographically and Remove duplicates..." << std::endl;
+
+    sortAndRemoveDuplicates(vertices, numberOfThreads);
+
+    //  the merge step needs the vertices in ascending order. Cost O(n)
+    meshVertices.clear();
+    meshVertices.reserve(vertices.size());
+    inputPositions.clear();
+    inputPositions.reserve(vertices.size());
+    for (auto vertex = vertices.rbegin(); vertex != vertices.rend(); ++vertex) {
+        meshVertices.push_back({(*vertex)[0], (*vertex)[1]});
+        inputPositions.push_back(static_cast<VertexIndex>(vertex->id));
+    }
+}
+
+////////////////////////////////////////////////////////////
+//                    Predicates                          //
+////////////////////////////////////////////////////////////
+
+template <typename Predicates>
+bool DivideAndConquerTriangulation<Predicates>::counterClockwise(VertexIndex a, VertexIndex b, VertexIndex c) const
+{
+    return Predicates::orientation(meshVertices[a].data(), meshVertices[b].data(),
+                                   meshVertices[c].data()) > 0;
+}
+
+template <typename Predicates>
+bool DivideAndConquerTriangulation<Predicates>::leftOf(VertexIndex vertex, EdgeIndex e) const
+{
+    return counterClockwise(vertex, quadEdgeMesh.org(e), quadEdgeMesh.dest(e));
+}
+
+template <typename Predicates>
+bool DivideAndConquerTriangulation<Predicates>::rightOf(VertexIndex vertex, EdgeIndex e) const
+{
+    return counterClockwise(vertex, quadEdgeMesh.dest(e), quadEdgeMesh.org(e));
+}
+
+template <typename Predicates>
+bool DivideAndConquerTriangulation<Predicates>::inCircumcircle(VertexIndex a, VertexIndex b, VertexIndex c,
+                                                               VertexIndex d) const
+{
+    //  the inCircle predicate expects clockwise triangles
+    return Predicates::inCircle(meshVertices[a].data(), meshVertices[c].data(), meshVertices[b].data(),
+                                meshVertices[d].data());
+}
+
+////////////////////////////////////////////////////////////
+//                    Divide and Conquer                  //
+////////////////////////////////////////////////////////////
+
+template <typename Predicates>
+bool DivideAndConquerTriangulation<Predicates>::precedes(VertexIndex a, VertexIndex b, int axis) const
+{
+    return precedesAlongAxis(meshVertices[a], meshVertices[b], axis);
+}
+
+////////////////////////////////////////////////////////////
+//                    Convex Hull                         //
+////////////////////////////////////////////////////////////
+
+template <typename Predicates>
+EdgeIndex DivideAndConquerTriangulation<Predicates>::hullEdgeOutOfFirstVertex(EdgeIndex ccwHullEdge, int axis) const
+{
+    //  the order is unimodal along the convex hull, therefore the walk goes either forwards or backwards
+    while (precedes(quadEdgeMesh.dest(ccwHullEdge), quadEdgeMesh.org(ccwHullEdge), axis)) {
+        ccwHullEdge = quadEdgeMesh.rprev(ccwHullEdge);
+    }
+    while (true) {
+        const EdgeIndex previousHullEdge = QuadEdgeMesh::sym(quadEdgeMesh.lnext(QuadEdgeMesh::sym(ccwHullEdge)));
+        if (!precedes(quadEdgeMesh.org(previousHullEdge), quadEdgeMesh.org(ccwHullEdge), axis)) {
+            break;
+        }
+        ccwHullEdge = previousHullEdge;
+    }
+    return ccwHullEdge;
+}
+
+template <typename Predicates>
+EdgeIndex DivideAndConquerTriangulation<Predicates>::hullEdgeOutOfLastVertex(EdgeIndex cwHullEdge, int axis) const
+{
+    //  walk along the counterclockwise hull edges and switch back to the clockwise one of the last vertex
+    EdgeIndex ccwHullEdge = quadEdgeMesh.onext(cwHullEdge);
+    while (precedes(quadEdgeMesh.org(ccwHullEdge), quadEdgeMesh.dest(ccwHullEdge), axis)) {
+        ccwHullEdge = quadEdgeMesh.rprev(ccwHullEdge);
+    }
+    while (true) {
+        const EdgeIndex previousHullEdge = QuadEdgeMesh::sym(quadEdgeMesh.lnext(QuadEdgeMesh::sym(ccwHullEdge)));
+        if (!precedes(quadEdgeMesh.org(ccwHullEdge), quadEdgeMesh.org(previousHullEdge), axis)) {
+            break;
+        }
+        ccwHullEdge = previousHullEdge;
+    }
+    return quadEdgeMesh.lnext(QuadEdgeMesh::sym(ccwHullEdge));
+}
+
+////////////////////////////////////////////////////////////
+//                    Divide and Conquer                  //
+////////////////////////////////////////////////////////////
+
+template <typename Predicates>
+std::pair<EdgeIndex, EdgeIndex>
+DivideAndConquerTriangulation<Predicates>::triangulate(VertexIndex first, VertexIndex last, int axis,
+                                                       QuadEdgeMesh::Allocator& allocator, unsigned parallelLevels)
+{
+    const VertexIndex numberOfVertices = last - first;
+
+    if (numberOfVertices <= 3) {
+        //  the base cases expect their vertices sorted along x
+        std::sort(meshVertices.begin() + first, meshVertices.begin() + last);
+    }
+
+    if (numberOfVertices == 2) {
+        const EdgeIndex a = quadEdgeMesh.makeEdge(first, first + 1, allocator);
+        return {a, QuadEdgeMesh::sym(a)};
+    }
+
+    if (numberOfVertices == 3) {
+        const VertexIndex s1 = first, s2 = first + 1, s3 = first + 2;
+
+        const EdgeIndex a = quadEdgeMesh.makeEdge(s1, s2, allocator);
+        const EdgeIndex b = quadEdgeMesh.makeEdge(s2, s3, allocator);
+        quadEdgeMesh.splice(QuadEdgeMesh::sym(a), b);
+
+        //  close the triangle, unless the three vertices are collinear
+        if (counterClockwise(s1, s2, s3)) {
+            quadEdgeMesh.connect(b, a, allocator);
+            return {a, QuadEdgeMesh::sym(b)};
+        } else if (counterClockwise(s1, s3, s2)) {
+            const EdgeIndex c = quadEdgeMesh.connect(b, a, allocator);
+            return {QuadEdgeMesh::sym(c), c};
+        }
+        return {a, QuadEdgeMesh::sym(b)};
+    }
+
+    //  split the vertices at the median along the axis of this level. Cost: O(n)
+    const VertexIndex middle = first + numberOfVertices / 2;
+    std::nth_element(meshVertices.begin() + first, meshVertices.begin() + middle, meshVertices.begin() + last,
+                     [axis](const std::array<double, 2>& Pa, const std::array<double, 2>& Pb) {
+                         return precedesAlongAxis(Pa, Pb, axis);
+                     });
+
+    std::pair<EdgeIndex, EdgeIndex> left, right;
+    if (parallelLevels > 0 && numberOfVertices >= 2 * MIN_PARALLEL_VERTICES) {
+        //  the left half is triangulated by a new thread with its own allocator
+        QuadEdgeMesh::Allocator leftAllocator;
+        std::thread leftThread([&]() {
+            left = triangulate(first, middle, 1 - axis, leftAllocator, parallelLevels - 1);
+            GeometricPredicates::flushFilterStatistics();
+        });
+        right = triangulate(middle, last, 1 - axis, allocator, parallelLevels - 1);
+        leftThread.join();
+
+        allocator.absorb(leftAllocator);
+    } else {
+        left = triangulate(first, middle, 1 - axis, allocator, 0);
+        right = triangulate(middle, last, 1 - axis, allocator, 0);
+    }
+
+    return mergeTriangulations(left, right, axis, allocator);
+}
+
+template <typename Predicates>
+std::pair<EdgeIndex, EdgeIndex>
+DivideAndConquerTriangulation<Predicates>::mergeTriangulations(std::pair<EdgeIndex, EdgeIndex> left,
+                                                               std::pair<EdgeIndex, EdgeIndex> right, int axis,
+                                                               QuadEdgeMesh::Allocator& allocator)
+{
+    auto[ldo, ldi] = left;
+    auto[rdi, rdo] = right;
+
+    //  a horizontal cut merges the bottom half with the top half, therefore the extreme vertices are moved from the
+    //  leftmost and rightmost vertices to the bottommost and topmost ones
+    if (axis == 1) {
+        ldo = hullEdgeOutOfFirstVertex(ldo, 1);
+        ldi = hullEdgeOutOfLastVertex(ldi, 1);
+        rdi = hullEdgeOutOfFirstVertex(rdi, 1);
+        rdo = hullEdgeOutOfLastVertex(rdo, 1);
+    }
+
+    //  compute the lower common tangent of the two halves
+    while (true) {
+        if (leftOf(quadEdgeMesh.org(rdi), ldi)) {
+            ldi = quadEdgeMesh.lnext(ldi);
+        } else if (rightOf(quadEdgeMesh.org(ldi), rdi)) {
+            rdi = quadEdgeMesh.rprev(rdi);
+        } else {
+            break;
+        }
+    }
+
+    //  create the first cross edge from the right to the left half
+    EdgeIndex basel = quadEdgeMesh.connect(QuadEdgeMesh::sym(rdi), ldi, allocator);
+    if (quadEdgeMesh.org(ldi) == quadEdgeMesh.org(ldo)) {
+        ldo = QuadEdgeMesh::sym(basel);
+    }
+    if (quadEdgeMesh.org(rdi) == quadEdgeMesh.org(rdo)) {
+        rdo = basel;
+    }
+
+    //  a candidate is valid if it lies above the current cross edge
+    const auto valid = [this, &basel](EdgeIndex e) {
+        return rightOf(quadEdgeMesh.dest(e), basel);
+    };
+
+    //  move the cross edge upwards until it becomes the upper common tangent
+    while (true) {
+        //  delete the edges of the left half that fail the circle test and find the left candidate
+        EdgeIndex lcand = quadEdgeMesh.onext(QuadEdgeMesh::sym(basel));
+        if (valid(lcand)) {
+            while (inCircumcircle(quadEdgeMesh.dest(basel), quadEdgeMesh.org(basel), quadEdgeMesh.dest(lcand),
+                                  quadEdgeMesh.dest(quadEdgeMesh.onext(lcand)))) {
+                const EdgeIndex t = quadEdgeMesh.onext(lcand);
+                quadEdgeMesh.deleteEdge(lcand, allocator);
+                lcand = t;
+            }
+        }
+
+        //  delete the edges of the right half that fail the circle test and find the right candidate
+        EdgeIndex rcand = quadEdgeMesh.oprev(basel);
+        if (valid(rcand)) {
+            while (inCircumcircle(quadEdgeMesh.dest(basel), quadEdgeMesh.org(basel), quadEdgeMesh.dest(rcand),
+                                  quadEdgeMesh.dest(quadEdgeMesh.oprev(rcand)))) {
+                const EdgeIndex t = quadEdgeMesh.oprev(rcand);
+                quadEdgeMesh.deleteEdge(rcand, allocator);
+                rcand = t;
+            }
+        }
+
+        const bool validLeftCandidate = valid(lcand);
+        const bool validRightCandidate = valid(rcand);
+        if (!validLeftCandidate && !validRightCandidate) {
+            break;
+        }
+
+        //  connect to the candidate whose circle does not contain the other one
+        if (!validLeftCandidate ||
+            (validRightCandidate && inCircumcircle(quadEdgeMesh.dest(lcand), quadEdgeMesh.org(lcand),
+                                                   quadEdgeMesh.org(rcand), quadEdgeMesh.dest(rcand)))) {
+            basel = quadEdgeMesh.connect(rcand, QuadEdgeMesh::sym(basel), allocator);
+        } else {
+            basel = quadEdgeMesh.connect(QuadEdgeMesh::sym(basel), QuadEdgeMesh::sym(lcand), allocator);
+        }
+    }
+
+    //  the caller expects the leftmost and the rightmost vertices
+    if (axis == 1) {
+        ldo = hullEdgeOutOfFirstVertex(ldo, 0);
+        rdo = hullEdgeOutOfLastVertex(rdo, 0);
+    }
+
+    return {ldo, rdo};
+}
+
+template <typename Predicates>
+void DivideAndConquerTriangulation<Predicates>::generateMesh()
+{
+    std::cout << std::endl << "Compute Delaunay Triangulation..." << std::endl;
+
+    meshingTimer.startTimer();
+
+    const auto numberOfVertices = static_cast<VertexIndex>(meshVertices.size());
+    if (numberOfVertices >= 2) {
+        //  each parallel level doubles the number of threads
+        unsigned parallelLevels = 0;
+        while ((1u << parallelLevels) < numberOfThreads) {
+            ++parallelLevels;
+        }
+
+        QuadEdgeMesh::Allocator allocator;
+        triangulate(0, numberOfVertices, 0, allocator, parallelLevels);
+    }
+
+    createOutputMesh();
+
+    std::cout << std::endl << "Mesh Vertices: " << outputMesh.verticesX.size() << std::endl;
+    std::cout << "Mesh Triangles: " << outputMesh.triangles.size() << std::endl;
+
+    meshingTimer.stopTimer();
+}
+
+template <typename Predicates>
+void DivideAndConquerTriangulation<Predicates>::createOutputMesh()
+{
+    std::cout << std::endl << "Compute Mesh Results..." << std::endl;
+
+    outputMesh = Mesh();
+
+    const size_t numberOfVertices = meshVertices.size();
+    const size_t vertexRanges = std::clamp<size_t>(numberOfVertices / MIN_OUTPUT_ITEMS_PER_THREAD, 1,
+                                                   numberOfThreads);
+
+    //  the median splits permuted the vertices, but they are unique, therefore the ascending order of the vertices
+    //  gives back the input positions that setInputVertices stored in that order. Cost: O(n)
+    outputMesh.verticesX.resize(numberOfVertices);
+    outputMesh.verticesY.resize(numberOfVertices);
+    std::vector<Vertex> rankedVertices(numberOfVertices);
+    runInRanges(numberOfVertices, vertexRanges, [&](size_t, size_t first, size_t last) {
+        for (size_t vertex = first; vertex < last; ++vertex) {
+            outputMesh.verticesX[vertex] = meshVertices[vertex][0];
+            outputMesh.verticesY[vertex] = meshVertices[vertex][1];
+            rankedVertices[vertex] = Vertex(meshVertices[vertex]);
+            rankedVertices[vertex].id = static_cast<int>(vertex);
+        }
+    });
+    ParallelSort::sortLexicographically(rankedVertices, numberOfThreads);
+
+    //  the sort is descending
+    outputMesh.inputPositions.resize(numberOfVertices);
+    runInRanges(numberOfVertices, vertexRanges, [&](size_t, size_t first, size_t last) {
+        for (size_t rank = first; rank < last; ++rank) {
+            outputMesh.inputPositions[rankedVertices[rank].id] = inputPositions[inputPositions.size() - 1 - rank];
+        }
+    });
+    rankedVertices = std::vector<Vertex>();
+    inputPositions = std::vector<VertexIndex>();
+
+    //  every triangle is the left face of three primal edges and it is stored once, by the edge with the smallest
+    //  index. The outer face is clockwise, therefore the orientation test rejects it when the convex hull has three
+    //  vertices. Each range of quads keeps its triangles and counts them by their first vertex.
+    const uint32_t numberOfQuads = quadEdgeMesh.numberOfQuads();
+    const size_t quadRanges = std::clamp<size_t>(numberOfQuads / MIN_OUTPUT_ITEMS_PER_THREAD, 1, numberOfThreads);
+    std::vector<std::vector<std::array<VertexIndex, 3>>> rangeTriangles(quadRanges);
+    std::vector<std::atomic<TriangleIndex>> nextTriangles(numberOfVertices);
+    runInRanges(numberOfQuads, quadRanges, [&](size_t range, size_t first, size_t last) {
+        auto& triangles = rangeTriangles[range];
+        for (auto quad = static_cast<uint32_t>(first); quad < last; ++quad) {
+            if (!quadEdgeMesh.isUsed(quad)) {
+                continue;
+            }
+            for (EdgeIndex e : {quad << 2u, QuadEdgeMesh::sym(quad << 2u)}) {
+                const EdgeIndex e1 = quadEdgeMesh.lnext(e);
+                const EdgeIndex e2 = quadEdgeMesh.lnext(e1);
+                if (e < e1 && e < e2 && quadEdgeMesh.lnext(e2) == e) {
+                    const VertexIndex a = quadEdgeMesh.org(e), b = quadEdgeMesh.org(e1), c = quadEdgeMesh.org(e2);
+                    if (counterClockwise(a, b, c)) {
+                        //  the incremental engines store clockwise triangles, which start from their smallest vertex
+                        std::array<VertexIndex, 3> triangle = {a, c, b};
+                        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()),
+                                    triangle.end());
+                        triangles.push_back(triangle);
+                        nextTriangles[triangle[0]].fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+        GeometricPredicates::flushFilterStatistics();
+    });
+
+    //  The ranges of quads scatter their triangles in the order of their scheduling, therefore the triangles are
+    //  ordered by their vertices with a counting sort, so the mesh does not depend on the threads. The triangles of a
+    //  vertex have distinct second vertices. Cost: O(n)
+    std::vector<TriangleIndex> vertexTriangles(numberOfVertices + 1, 0);
+    for (size_t vertex = 0; vertex < numberOfVertices; ++vertex) {
+        vertexTriangles[vertex + 1] = vertexTriangles[vertex] + nextTriangles[vertex].load(std::memory_order_relaxed);
+        nextTriangles[vertex].store(vertexTriangles[vertex], std::memory_order_relaxed);
+    }
+
+    outputMesh.triangles.resize(vertexTriangles.back());
+    runInRanges(quadRanges, quadRanges, [&](size_t range, size_t, size_t) {
+        for (const auto& triangle : rangeTriangles[range]) {
+            outputMesh.triangles[nextTriangles[triangle[0]].fetch_add(1, std::memory_order_relaxed)] = triangle;
+        }
+        rangeTriangles[range] = std::vector<std::array<VertexIndex, 3>>();
+    });
+    nextTriangles = std::vector<std::atomic<TriangleIndex>>();
+
+    runInRanges(numberOfVertices, vertexRanges, [&](size_t, size_t first, size_t last) {
+        for (size_t vertex = first; vertex < last; ++vertex) {
+            std::sort(outputMesh.triangles.begin() + vertexTriangles[vertex],
+                      outputMesh.triangles.begin() + vertexTriangles[vertex + 1]);
+        }
+    });
+
+    quadEdgeMesh.release();
+    meshVertices.clear();
+    meshVertices.shrink_to_fit();
+
+    MemoryUsage::releaseFreeMemory();
+}
+
+template class DivideAndConquerTriangulation<GeometricPredicates::Fast>;
+template class DivideAndConquerTriangulation<GeometricPredicates::Filtered>;
@@ -7,58 +7,45 @@
  * Created on   4/5/20.
  */
 
+#include <mutex>
 #include "GeometricPredicates.hxx"
 
 
 extern "C" {
-#define REAL double
 void exactinit();
-REAL orient2d(REAL* pa, REAL* pb, REAL* pc);
-REAL orient2dfast(REAL* pa, REAL* pb, REAL* pc);
-REAL incircle(REAL* pa, REAL* pb, REAL* pc, REAL* pd);
-REAL incirclefast(REAL* pa, REAL* pb, REAL* pc, REAL* pd);
 }
 
 namespace GeometricPredicates
 {
-    double (* orient2dTest)(REAL* pa, REAL* pb, REAL* pc);
+    //  statistics that the threads have flushed
+    static std::mutex filterStatisticsMutex;
+    static FilterStatistics filterStatistics;
 
-    double (* inCircleTest)(REAL* pa, REAL* pb, REAL* pc, REAL* pd);
-
-    void initialize(bool robustPredicates)
+    void initialize()
     {
         exactinit();
-        if (robustPredicates) {
-            orient2dTest = orient2d;
-            inCircleTest = incircle;
-        } else {
-            orient2dTest = orient2dfast;
-            inCircleTest = incirclefast;
-        }
     }
 
-    bool inCircle(const TriangleHandle& triangle, const VertexHandle& vertex)
+    void flushFilterStatistics()
     {
-        return inCircleTest(triangle->vertices[0]->coordinates,
-                            triangle->vertices[1]->coordinates,
-                            triangle->vertices[2]->coordinates,
-                            vertex->coordinates) < 0;
+        std::lock_guard<std::mutex> lock(filterStatisticsMutex);
+        filterStatistics.orientationTests += threadFilterStatistics.orientationTests;
+        filterStatistics.orientationFallbacks += threadFilterStatistics.orientationFallbacks;
+        filterStatistics.inCircleTests += threadFilterStatistics.inCircleTests;
+        filterStatistics.inCircleFallbacks += threadFilterStatistics.inCircleFallbacks;
+
+        threadFilterStatistics = FilterStatistics();
     }
 
-    bool inTriangle(const TriangleHandle& triangle, const VertexHandle& vertex, std::array<double, 3>& orientationTests)
+    FilterStatistics getFilterStatistics()
     {
-        orientationTests[0] = orient2dTest(triangle->vertices[0]->coordinates,
-                                           triangle->vertices[1]->coordinates,
-                                           vertex->coordinates);
-
-        orientationTests[1] = orient2dTest(triangle->vertices[1]->coordinates,
-                                           triangle->vertices[2]->coordinates,
-                                           vertex->coordinates);
-
-        orientationTests[2] = orient2dTest(triangle->vertices[2]->coordinates,
-                                           triangle->vertices[0]->coordinates,
-                                           vertex->coordinates);
-
-        return orientationTests[0] <= 0 && orientationTests[1] <= 0 && orientationTests[2] <= 0;
+        std::lock_guard<std::mutex> lock(filterStatisticsMutex);
+        FilterStatistics statistics = filterStatistics;
+        statistics.orientationTests += threadFilterStatistics.orientationTests;
+        statistics.orientationFallbacks += threadFilterStatistics.orientationFallbacks;
+        statistics.inCircleTests += threadFilterStatistics.inCircleTests;
+        statistics.inCircleFallbacks += threadFilterStatistics.inCircleFallbacks;
+
+        return statistics;
     }
-}
\ No newline at end of file
+}
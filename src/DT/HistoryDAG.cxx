@@ -12,95 +12,101 @@
 
 HistoryDAG::HistoryDAG()
 {
-    rootTriangle = nullptr;
+    boundingVertices.fill(nullptr);
 }
 
 HistoryDAG::~HistoryDAG() = default;
 
-void HistoryDAG::setRootTriangle(TriangleHandle& rootTriangle)
+void HistoryDAG::reserve(size_t numberOfVertices)
 {
-    this->rootTriangle = rootTriangle;
+    //  at most 9n + 1 triangles are created, and only the touched pages of the reserved nodes are resident
+    nodes.reserve(9 * numberOfVertices + 1);
+    leafTriangles.reserve(9 * numberOfVertices + 1);
 }
 
-TriangleHandle& HistoryDAG::locateTriangle(TriangleHandle& triangle, VertexHandle vertex,
-                                           std::array<double, 3>& orientationTests)
+uint32_t HistoryDAG::addTriangle(const TriangleHandle& triangle)
 {
-    size_t childrenSize = triangle->childrenTriangles.size();
-
-    if (childrenSize == 0) {  //  base case
-        //  This is mandatory to be executed because orientationTests array has to be updated
-        //  for the case where a point falls on an edge of a triangle.
-        GeometricPredicates::inTriangle(triangle, vertex, orientationTests);
-        return triangle;
-    } else if (childrenSize == 2) {
-        if (GeometricPredicates::inTriangle(triangle->childrenTriangles[0], vertex, orientationTests)) {
-            return locateTriangle(triangle->childrenTriangles[0], vertex, orientationTests);
-        } else {
-            return locateTriangle(triangle->childrenTriangles[1], vertex, orientationTests);
-        }
-    } else { // childrenSize == 3
-        if (GeometricPredicates::inTriangle(triangle->childrenTriangles[0], vertex, orientationTests)) {
-            return locateTriangle(triangle->childrenTriangles[0], vertex, orientationTests);
-        } else if (GeometricPredicates::inTriangle(triangle->childrenTriangles[1], vertex, orientationTests)) {
-            return locateTriangle(triangle->childrenTriangles[1], vertex, orientationTests);
-        } else {
-            return locateTriangle(triangle->childrenTriangles[2], vertex, orientationTests);
+    if (nodes.empty()) {
+        boundingVertices = triangle->vertices;
+    }
+
+    Node node{};
+    for (size_t i = 0; i < 3; ++i) {
+        node.coordinates[2 * i] = (*triangle->vertices[i])[0];
+        node.coordinates[2 * i + 1] = (*triangle->vertices[i])[1];
+    }
+    node.children.fill(NO_NODE);
+    node.numberOfChildren = 0;
+
+    nodes.push_back(node);
+    leafTriangles.push_back(triangle);
+
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+void HistoryDAG::addChildTriangles(const TriangleHandle& triangle, const std::array<TriangleHandle, 3>& children)
+{
+    Node& node = nodes[triangle->dagNode];
+    for (const auto& child : children) {
+        if (child != nullptr) {
+            node.children[node.numberOfChildren++] = child->dagNode;
         }
     }
+    leafTriangles[triangle->dagNode] = nullptr;
 }
 
-bool HistoryDAG::containsBoundingTriangleVertices(TriangleHandle triangle) const
+void HistoryDAG::clear()
 {
-    return triangle->containsVertex(rootTriangle->vertices[0]) ||
-           triangle->containsVertex(rootTriangle->vertices[1]) ||
-           triangle->containsVertex(rootTriangle->vertices[2]);
+    nodes = std::vector<Node>();
+    leafTriangles = std::vector<TriangleHandle>();
+    boundingVertices.fill(nullptr);
 }
 
-void HistoryDAG::extractTriangulationWithoutBoundingTriangle(std::vector<TriangleHandle>& triangles,
-                                                             TriangleHandle& triangle)
+template <typename Predicates>
+TriangleHandle HistoryDAG::locateTriangle(VertexHandle vertex, std::array<double, 3>& orientationTests) const
 {
-    if (!triangle->visitedTriangle) {
-        size_t childrenSize = triangle->childrenTriangles.size();
-        if (childrenSize == 0) {  //  base case
-            triangle->visitedTriangle = true;
-            if (!containsBoundingTriangleVertices(triangle)) {
-                triangles.push_back(triangle);
+    const double* const point = vertex->coordinates;
+
+    uint32_t nodeIndex = 0;
+    while (nodes[nodeIndex].numberOfChildren != 0) {
+        const Node& node = nodes[nodeIndex];
+
+        //  the triangle lies in its parent, therefore the last child contains it if the others do not
+        nodeIndex = node.children[node.numberOfChildren - 1];
+        for (uint32_t i = 0; i + 1 < node.numberOfChildren; ++i) {
+            const double* const child = nodes[node.children[i]].coordinates.data();
+            if (GeometricPredicates::inTriangle<Predicates>(child, child + 2, child + 4, point, orientationTests)) {
+                nodeIndex = node.children[i];
+                break;
             }
-        } else if (childrenSize == 2) {
-            triangle->visitedTriangle = true;
-            extractTriangulationWithoutBoundingTriangle(triangles, triangle->childrenTriangles[0]);
-            extractTriangulationWithoutBoundingTriangle(triangles, triangle->childrenTriangles[1]);
-        } else { //   childrenSize == 3
-            triangle->visitedTriangle = true;
-            extractTriangulationWithoutBoundingTriangle(triangles, triangle->childrenTriangles[0]);
-            extractTriangulationWithoutBoundingTriangle(triangles, triangle->childrenTriangles[1]);
-            extractTriangulationWithoutBoundingTriangle(triangles, triangle->childrenTriangles[2]);
         }
     }
-}
 
-TriangleHandle& HistoryDAG::locateTriangle(VertexHandle vertex, std::array<double, 3>& orientationTests)
-{
-    return locateTriangle(rootTriangle, vertex, orientationTests);
+    //  This is mandatory to be executed because orientationTests array has to be updated
+    //  for the case where a point falls on an edge of a triangle.
+    const double* const leaf = nodes[nodeIndex].coordinates.data();
+    GeometricPredicates::inTriangle<Predicates>(leaf, leaf + 2, leaf + 4, point, orientationTests);
+
+    return leafTriangles[nodeIndex];
 }
 
-std::vector<TriangleHandle> HistoryDAG::extractTriangulationWithoutBoundingTriangle()
+std::vector<TriangleHandle> HistoryDAG::extractTriangulationWithoutBoundingTriangle() const
 {
     std::cout << std::endl << "Compute Mesh Results..." << std::endl;
 
     std::vector<TriangleHandle> triangles;
 
-    extractTriangulationWithoutBoundingTriangle(triangles, rootTriangle);
-
-    delete rootTriangle->edges[0];
-    delete rootTriangle->edges[1];
-    delete rootTriangle->edges[2];
-
-    delete rootTriangle->vertices[0];
-    delete rootTriangle->vertices[1];
-    delete rootTriangle->vertices[2];
-
-    delete rootTriangle;
+    for (const auto& triangle : leafTriangles) {
+        if (triangle != nullptr && !triangle->containsVertex(boundingVertices[0]) &&
+            !triangle->containsVertex(boundingVertices[1]) && !triangle->containsVertex(boundingVertices[2])) {
+            triangles.push_back(triangle);
+        }
+    }
 
     return triangles;
 }
+
+template TriangleHandle HistoryDAG::locateTriangle<GeometricPredicates::Fast>(
+        VertexHandle vertex, std::array<double, 3>& orientationTests) const;
+template TriangleHandle HistoryDAG::locateTriangle<GeometricPredicates::Filtered>(
+        VertexHandle vertex, std::array<double, 3>& orientationTests) const;
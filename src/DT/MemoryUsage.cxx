@@ -0,0 +1,48 @@
+/*
+ * Filename:    MemoryUsage.cxx
+ *
+ * Description: Source file of namespace MemoryUsage.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <fstream>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include <sys/resource.h>
+#include <unistd.h>
+#include "MemoryUsage.hxx"
+
+
+namespace MemoryUsage
+{
+    double getCurrentResidentSetSize()
+    {
+        //  the second field of statm is the number of resident pages
+        std::ifstream statm("/proc/self/statm");
+        size_t totalPages = 0, residentPages = 0;
+        if (!(statm >> totalPages >> residentPages)) {
+            return 0;
+        }
+        return static_cast<double>(residentPages) * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0);
+    }
+
+    double getPeakResidentSetSize()
+    {
+        struct rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+        //  ru_maxrss is in KB
+        return static_cast<double>(usage.ru_maxrss) / 1024.0;
+    }
+
+    void releaseFreeMemory()
+    {
+#ifdef __GLIBC__
+        malloc_trim(0);
+#endif
+    }
+}
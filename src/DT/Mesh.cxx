@@ -0,0 +1,61 @@
+/*
+ * Filename:    Mesh.cxx
+ *
+ * Description: Source file of Mesh struct.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <utility>
+#include "Mesh.hxx"
+
+
+//  Fast lookup arrays to speed up the mesh manipulation primitives
+static constexpr int plus1mod3[3] = {1, 2, 0};
+
+std::vector<std::array<TriangleIndex, 3>> Mesh::computeTriangleNeighbors() const
+{
+    const auto numberOfVertices = static_cast<VertexIndex>(verticesX.size());
+    const auto numberOfTriangles = static_cast<TriangleIndex>(triangles.size());
+
+    //  the corners of the triangles around each vertex, in compressed rows
+    std::vector<TriangleIndex> firstVertexCorner(numberOfVertices + 1, 0);
+    for (const auto& triangle : triangles) {
+        for (const VertexIndex vertex : triangle) {
+            ++firstVertexCorner[vertex + 1];
+        }
+    }
+    for (VertexIndex vertex = 0; vertex < numberOfVertices; ++vertex) {
+        firstVertexCorner[vertex + 1] += firstVertexCorner[vertex];
+    }
+
+    //  each corner of a triangle is stored in the row of its vertex, together with the next vertex of the triangle
+    std::vector<std::pair<VertexIndex, TriangleIndex>> vertexCorners(firstVertexCorner[numberOfVertices]);
+    std::vector<TriangleIndex> nextVertexCorner(firstVertexCorner.begin(), firstVertexCorner.end() - 1);
+    for (TriangleIndex triangle = 0; triangle < numberOfTriangles; ++triangle) {
+        for (int i = 0; i < 3; ++i) {
+            const VertexIndex vertex = triangles[triangle][i];
+            vertexCorners[nextVertexCorner[vertex]++] = {triangles[triangle][plus1mod3[i]], triangle};
+        }
+    }
+
+    //  the neighbor across the edge PiPj is the triangle whose corner at Pj is followed by Pi
+    std::vector<std::array<TriangleIndex, 3>> triangleNeighbors(numberOfTriangles,
+                                                                {NO_TRIANGLE, NO_TRIANGLE, NO_TRIANGLE});
+    for (TriangleIndex triangle = 0; triangle < numberOfTriangles; ++triangle) {
+        for (int edgeId = 0; edgeId < 3; ++edgeId) {
+            const VertexIndex Pi = triangles[triangle][edgeId];
+            const VertexIndex Pj = triangles[triangle][plus1mod3[edgeId]];
+
+            for (TriangleIndex i = firstVertexCorner[Pj]; i < firstVertexCorner[Pj + 1]; ++i) {
+                if (vertexCorners[i].first == Pi) {
+                    triangleNeighbors[triangle][edgeId] = vertexCorners[i].second;
+                    break;
+                }
+            }
+        }
+    }
+
+    return triangleNeighbors;
+}
@@ -0,0 +1,468 @@
+/*
+ * Filename:    ParallelSort.cxx
+ *
+ * Description: Source file of namespace ParallelSort.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include "ParallelSort.hxx"
+#include "RandomGenerator.hxx"
+
+
+namespace ParallelSort
+{
+    //  ranges smaller than this are not worth a thread
+    constexpr size_t MIN_VERTICES_PER_THREAD = 16384;
+
+    //  each coordinate is sorted by six digits of 11 bits, and its last digit overlaps the previous one
+    constexpr unsigned RADIX_BITS = 11;
+    constexpr size_t NUMBER_OF_BUCKETS = size_t(1) << RADIX_BITS;
+    constexpr unsigned DIGIT_SHIFTS[] = {53, 42, 31, 20, 9, 0};
+    constexpr unsigned DIGITS_PER_COORDINATE = sizeof(DIGIT_SHIFTS) / sizeof(DIGIT_SHIFTS[0]);
+    constexpr unsigned NUMBER_OF_DIGITS = 2 * DIGITS_PER_COORDINATE;
+
+    //  the shuffle splits the vertices in random buckets of about this size, which are shuffled in parallel
+    constexpr size_t MIN_VERTICES_PER_BUCKET = 65536;
+    constexpr size_t MAX_NUMBER_OF_BUCKETS = 1024;
+
+    //  buckets smaller than this are sorted by comparisons
+    constexpr size_t MAX_COMPARISON_SORT_SIZE = 256;
+
+    using BucketCounts = std::array<size_t, NUMBER_OF_BUCKETS>;
+
+    /**
+     * @brief Runs a function on contiguous ranges of items, one per thread. The calling thread runs the first range.
+     *
+     * @param numberOfItems is the number of items
+     * @param numberOfRanges is the number of ranges
+     * @param function is called with the index, the first item, and the item after the last item of each range
+     */
+    template <typename Function>
+    static void runInRanges(size_t numberOfItems, size_t numberOfRanges, const Function& function)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(numberOfRanges - 1);
+        for (size_t range = 1; range < numberOfRanges; ++range) {
+            threads.emplace_back(function, range, range * numberOfItems / numberOfRanges,
+                                 (range + 1) * numberOfItems / numberOfRanges);
+        }
+        function(0, 0, numberOfItems / numberOfRanges);
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * @brief Computes the number of ranges of vertices that are processed by separate threads.
+     */
+    static size_t computeNumberOfRanges(size_t numberOfVertices, unsigned numberOfThreads)
+    {
+        return std::clamp<size_t>(numberOfVertices / MIN_VERTICES_PER_THREAD, 1, numberOfThreads);
+    }
+
+    /**
+     * @brief Computes the key of a coordinate, an unsigned integer in the order of the doubles.
+     *
+     * @param coordinate is the coordinate
+     * @return the key of the coordinate
+     */
+    static inline uint64_t computeKey(double coordinate)
+    {
+        //  0.0 and -0.0 are equal, therefore they get the same key
+        coordinate += 0.0;
+        uint64_t bits;
+        std::memcpy(&bits, &coordinate, sizeof(bits));
+
+        //  the keys of the positive doubles follow the keys of the negative ones, which are ordered in reverse
+        return (bits >> 63u) != 0 ? ~bits : bits | (uint64_t(1) << 63u);
+    }
+
+    /**
+     * @brief Computes the digit of a vertex, where the digits of the descending order ascend.
+     *
+     * @param vertex is the vertex
+     * @param digit is the index of the digit, whose first half are the digits of the x coordinate
+     * @return the bucket of the vertex
+     */
+    static inline size_t computeDigit(const Vertex& vertex, unsigned digit)
+    {
+        const uint64_t key = computeKey(vertex[digit / DIGITS_PER_COORDINATE]);
+
+        return (~key >> DIGIT_SHIFTS[digit % DIGITS_PER_COORDINATE]) & (NUMBER_OF_BUCKETS - 1);
+    }
+
+    /**
+     * @brief Mixes the bits of a 64-bit integer (finalizer of MurmurHash3).
+     */
+    static inline uint64_t mixBits(uint64_t value)
+    {
+        value ^= value >> 33u;
+        value *= UINT64_C(0xff51afd7ed558ccd);
+        value ^= value >> 33u;
+        value *= UINT64_C(0xc4ceb9fe1a85ec53);
+        value ^= value >> 33u;
+        return value;
+    }
+
+    /**
+     * @brief Counts the vertices of each bucket of the first digit that splits a range of vertices.
+     *
+     * @param vertices are the vertices of the range
+     * @param numberOfVertices is the number of vertices of the range
+     * @param digit is the first digit that may split the range
+     * @param counts are the number of vertices of each bucket of the returned digit
+     * @return the first digit that splits the range, or NUMBER_OF_DIGITS if the vertices are equal
+     */
+    static unsigned countSplittingDigit(const Vertex* vertices, size_t numberOfVertices, unsigned digit,
+                                        BucketCounts& counts)
+    {
+        for (; digit < NUMBER_OF_DIGITS; ++digit) {
+            counts.fill(0);
+            for (size_t i = 0; i < numberOfVertices; ++i) {
+                ++counts[computeDigit(vertices[i], digit)];
+            }
+
+            if (*std::max_element(counts.begin(), counts.end()) != numberOfVertices) {
+                break;
+            }
+        }
+
+        return digit;
+    }
+
+    /**
+     * @brief Sorts a range of vertices whose digits before a given one are equal.
+     * The range is scattered to the scratch range by its first splitting digit, and each bucket is sorted
+     * recursively with the roles of the two ranges swapped, so the vertices are never copied back.
+     *
+     * @param vertices are the vertices of the range
+     * @param scratch is a scratch range of the same size
+     * @param numberOfVertices is the number of vertices of the range
+     * @param digit is the first digit that may split the range
+     * @param resultInScratch is true if the sorted vertices must be stored in the scratch range
+     */
+    static void sortRange(Vertex* vertices, Vertex* scratch, size_t numberOfVertices, unsigned digit,
+                          bool resultInScratch)
+    {
+        //  most ranges are small buckets, whose counts are not even initialized
+        BucketCounts bucketStarts;
+        if (numberOfVertices > MAX_COMPARISON_SORT_SIZE) {
+            digit = countSplittingDigit(vertices, numberOfVertices, digit, bucketStarts);
+        }
+
+        if (numberOfVertices <= MAX_COMPARISON_SORT_SIZE || digit == NUMBER_OF_DIGITS) {
+            Vertex* const result = resultInScratch ? scratch : vertices;
+            if (resultInScratch) {
+                std::copy(vertices, vertices + numberOfVertices, scratch);
+            }
+            if (digit < NUMBER_OF_DIGITS) {
+                std::sort(result, result + numberOfVertices, std::greater<>());
+            }
+            return;
+        }
+
+        size_t start = 0;
+        for (auto& bucketStart : bucketStarts) {
+            start += std::exchange(bucketStart, start);
+        }
+
+        BucketCounts bucketEnds = bucketStarts;
+        for (size_t i = 0; i < numberOfVertices; ++i) {
+            scratch[bucketEnds[computeDigit(vertices[i], digit)]++] = vertices[i];
+        }
+
+        for (size_t bucket = 0; bucket < NUMBER_OF_BUCKETS; ++bucket) {
+            const size_t first = bucketStarts[bucket];
+            sortRange(scratch + first, vertices + first, bucketEnds[bucket] - first, digit + 1, !resultInScratch);
+        }
+    }
+
+    /**
+     * @brief Scatters a range of vertices to a range of the same size by its first splitting digit, with one thread
+     * per part of the range. Each part scatters its vertices after those of the previous parts in each bucket.
+     *
+     * @param source are the vertices of the range
+     * @param destination is the range that receives the scattered vertices
+     * @param numberOfVertices is the number of vertices of the range
+     * @param digit is the first digit that may split the range
+     * @param numberOfRanges is the number of parts of the range, which are processed by separate threads
+     * @param bucketStarts are the positions of the buckets in the destination range
+     * @return the first digit that splits the range, or NUMBER_OF_DIGITS if the vertices are equal and they were not
+     * scattered
+     */
+    static unsigned scatterRange(const Vertex* source, Vertex* destination, size_t numberOfVertices, unsigned digit,
+                                 size_t numberOfRanges, BucketCounts& bucketStarts)
+    {
+        std::vector<BucketCounts> rangeCounts(numberOfRanges);
+        for (; digit < NUMBER_OF_DIGITS; ++digit) {
+            runInRanges(numberOfVertices, numberOfRanges, [&](size_t range, size_t first, size_t last) {
+                rangeCounts[range].fill(0);
+                for (size_t i = first; i < last; ++i) {
+                    ++rangeCounts[range][computeDigit(source[i], digit)];
+                }
+            });
+
+            BucketCounts counts{};
+            for (const auto& rangeCount : rangeCounts) {
+                for (size_t bucket = 0; bucket < NUMBER_OF_BUCKETS; ++bucket) {
+                    counts[bucket] += rangeCount[bucket];
+                }
+            }
+            if (*std::max_element(counts.begin(), counts.end()) != numberOfVertices) {
+                break;
+            }
+        }
+        if (digit == NUMBER_OF_DIGITS) {
+            return digit;
+        }
+
+        std::vector<BucketCounts> rangeStarts(numberOfRanges);
+        size_t start = 0;
+        for (size_t bucket = 0; bucket < NUMBER_OF_BUCKETS; ++bucket) {
+            bucketStarts[bucket] = start;
+            for (size_t range = 0; range < numberOfRanges; ++range) {
+                rangeStarts[range][bucket] = start;
+                start += rangeCounts[range][bucket];
+            }
+        }
+
+        runInRanges(numberOfVertices, numberOfRanges, [&](size_t range, size_t first, size_t last) {
+            BucketCounts& ends = rangeStarts[range];
+            for (size_t i = first; i < last; ++i) {
+                destination[ends[computeDigit(source[i], digit)]++] = source[i];
+            }
+        });
+
+        return digit;
+    }
+
+    void sortLexicographically(std::vector<Vertex>& vertices, unsigned numberOfThreads)
+    {
+        const size_t numberOfVertices = vertices.size();
+        if (numberOfVertices < 2) {
+            return;
+        }
+
+        const size_t numberOfRanges = computeNumberOfRanges(numberOfVertices, numberOfThreads);
+        std::vector<Vertex> scratch(numberOfVertices);
+
+        //  a range of vertices whose digits before the given one are equal, which is stored in the scratch vector or
+        //  in the vertices
+        struct Task
+        {
+            size_t first;
+            size_t numberOfVertices;
+            unsigned digit;
+            bool inScratch;
+        };
+
+        //  a bucket of the first digit may hold half of the vertices, e.g. when they share the sign and the exponent,
+        //  therefore the ranges larger than this are scattered again by all threads instead of sorted by one thread
+        const size_t maxTaskSize = std::max(numberOfVertices / (4 * numberOfRanges), MIN_VERTICES_PER_THREAD);
+
+        std::vector<Task> largeTasks = {{0, numberOfVertices, 0, false}};
+        std::vector<Task> tasks;
+        while (!largeTasks.empty()) {
+            const Task task = largeTasks.back();
+            largeTasks.pop_back();
+
+            Vertex* const source = (task.inScratch ? scratch.data() : vertices.data()) + task.first;
+            Vertex* const destination = (task.inScratch ? vertices.data() : scratch.data()) + task.first;
+            BucketCounts bucketStarts;
+            const unsigned digit = scatterRange(source, destination, task.numberOfVertices, task.digit,
+                                                computeNumberOfRanges(task.numberOfVertices, numberOfThreads),
+                                                bucketStarts);
+            if (digit == NUMBER_OF_DIGITS) {
+                tasks.push_back({task.first, task.numberOfVertices, digit, task.inScratch});
+                continue;
+            }
+
+            for (size_t bucket = 0; bucket < NUMBER_OF_BUCKETS; ++bucket) {
+                const size_t first = bucketStarts[bucket];
+                const size_t last = bucket + 1 < NUMBER_OF_BUCKETS ? bucketStarts[bucket + 1] : task.numberOfVertices;
+                if (first == last) {
+                    continue;
+                }
+
+                const Task bucketTask = {task.first + first, last - first, digit + 1, !task.inScratch};
+                (bucketTask.numberOfVertices > maxTaskSize ? largeTasks : tasks).push_back(bucketTask);
+            }
+        }
+
+        //  the remaining ranges are sorted back into the vertices by the threads that take them, the largest first,
+        //  so that the threads finish together
+        std::sort(tasks.begin(), tasks.end(), [](const Task& a, const Task& b) {
+            return a.numberOfVertices > b.numberOfVertices;
+        });
+        std::atomic<size_t> nextTask{0};
+        runInRanges(numberOfVertices, numberOfRanges, [&](size_t, size_t, size_t) {
+            for (size_t i = nextTask++; i < tasks.size(); i = nextTask++) {
+                const Task& task = tasks[i];
+                Vertex* const source = (task.inScratch ? scratch.data() : vertices.data()) + task.first;
+                Vertex* const destination = (task.inScratch ? vertices.data() : scratch.data()) + task.first;
+                sortRange(source, destination, task.numberOfVertices, task.digit, task.inScratch);
+            }
+        });
+    }
+
+    void removeDuplicates(std::vector<Vertex>& vertices, unsigned numberOfThreads)
+    {
+        const size_t numberOfVertices = vertices.size();
+        const size_t numberOfRanges = computeNumberOfRanges(numberOfVertices, numberOfThreads);
+
+        const auto isFirstOfRun = [&vertices](size_t i) {
+            return i == 0 || vertices[i] != vertices[i - 1];
+        };
+
+        std::vector<size_t> rangeStarts(numberOfRanges + 1, 0);
+        runInRanges(numberOfVertices, numberOfRanges, [&](size_t range, size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                rangeStarts[range + 1] += isFirstOfRun(i);
+            }
+        });
+
+        for (size_t range = 0; range < numberOfRanges; ++range) {
+            rangeStarts[range + 1] += rangeStarts[range];
+        }
+        if (rangeStarts[numberOfRanges] == numberOfVertices) {
+            return;
+        }
+
+        //  the ranges overlap their destinations, therefore they are compacted to a new vector
+        std::vector<Vertex> uniqueVertices(rangeStarts[numberOfRanges]);
+        runInRanges(numberOfVertices, numberOfRanges, [&](size_t range, size_t first, size_t last) {
+            size_t position = rangeStarts[range];
+            for (size_t i = first; i < last; ++i) {
+                if (isFirstOfRun(i)) {
+                    uniqueVertices[position++] = vertices[i];
+                }
+            }
+        });
+
+        vertices.swap(uniqueVertices);
+    }
+
+    void removeDuplicatesByHashing(std::vector<Vertex>& vertices, std::vector<std::pair<size_t, size_t>>& duplicates)
+    {
+        //  a slot holds the position of a vertex and the upper half of its hash
+        struct Slot
+        {
+            uint32_t vertex;
+            uint32_t fingerprint;
+        };
+        constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+
+        const size_t numberOfVertices = vertices.size();
+        duplicates.clear();
+
+        //  the set is at most half full, therefore the linear probes are short
+        size_t numberOfSlots = 16;
+        while (numberOfSlots < 2 * numberOfVertices) {
+            numberOfSlots *= 2;
+        }
+        std::vector<Slot> slots(numberOfSlots, Slot{EMPTY_SLOT, 0});
+
+        for (size_t i = 0; i < numberOfVertices; ++i) {
+            const uint64_t hash = mixBits(computeKey(vertices[i][0]) ^ mixBits(computeKey(vertices[i][1])));
+            const auto fingerprint = static_cast<uint32_t>(hash >> 32u);
+
+            size_t slot = hash & (numberOfSlots - 1);
+            while (slots[slot].vertex != EMPTY_SLOT && (slots[slot].fingerprint != fingerprint ||
+                                                        vertices[slots[slot].vertex] != vertices[i])) {
+                slot = (slot + 1) & (numberOfSlots - 1);
+            }
+
+            if (slots[slot].vertex == EMPTY_SLOT) {
+                slots[slot] = {static_cast<uint32_t>(i), fingerprint};
+            } else {
+                duplicates.emplace_back(i, slots[slot].vertex);
+            }
+        }
+
+        if (duplicates.empty()) {
+            return;
+        }
+
+        //  the duplicates are in the input order, therefore the vertices are compacted in one pass
+        size_t position = 0;
+        auto duplicate = duplicates.begin();
+        for (size_t i = 0; i < numberOfVertices; ++i) {
+            if (duplicate != duplicates.end() && duplicate->first == i) {
+                ++duplicate;
+            } else {
+                vertices[position++] = vertices[i];
+            }
+        }
+        vertices.resize(position);
+    }
+
+    void shuffle(std::vector<Vertex>& vertices, uint64_t seed, unsigned numberOfThreads)
+    {
+        const size_t numberOfVertices = vertices.size();
+
+        //  the buckets depend only on the number of vertices, therefore neither does the permutation
+        const size_t numberOfBuckets = std::clamp<size_t>(numberOfVertices / MIN_VERTICES_PER_BUCKET, 1,
+                                                          MAX_NUMBER_OF_BUCKETS);
+        if (numberOfBuckets == 1) {
+            RandomGenerator(seed, 0).shuffle(vertices.begin(), vertices.end());
+            return;
+        }
+
+        //  the bucket of the i-th vertex is the i-th number of the first stream
+        const size_t numberOfRanges = computeNumberOfRanges(numberOfVertices, numberOfThreads);
+        std::vector<uint32_t> buckets(numberOfVertices);
+        std::vector<std::vector<size_t>> rangeCounts(numberOfRanges, std::vector<size_t>(numberOfBuckets, 0));
+        runInRanges(numberOfVertices, numberOfRanges, [&](size_t range, size_t first, size_t last) {
+            RandomGenerator randomGenerator(seed, 0, first);
+            for (size_t i = first; i < last; ++i) {
+                buckets[i] = static_cast<uint32_t>(randomGenerator.uniformInteger(numberOfBuckets));
+                ++rangeCounts[range][buckets[i]];
+            }
+        });
+
+        //  each range scatters its vertices after those of the previous ranges in each bucket, which keeps the
+        //  vertices of a bucket in the order of the input
+        std::vector<size_t> bucketStarts(numberOfBuckets + 1, 0);
+        std::vector<std::vector<size_t>> rangeStarts(numberOfRanges, std::vector<size_t>(numberOfBuckets, 0));
+        size_t start = 0;
+        for (size_t bucket = 0; bucket < numberOfBuckets; ++bucket) {
+            bucketStarts[bucket] = start;
+            for (size_t range = 0; range < numberOfRanges; ++range) {
+                rangeStarts[range][bucket] = start;
+                start += rangeCounts[range][bucket];
+            }
+        }
+        bucketStarts[numberOfBuckets] = numberOfVertices;
+
+        std::vector<Vertex> shuffledVertices(numberOfVertices);
+        runInRanges(numberOfVertices, numberOfRanges, [&](size_t range, size_t first, size_t last) {
+            std::vector<size_t>& ends = rangeStarts[range];
+            for (size_t i = first; i < last; ++i) {
+                shuffledVertices[ends[buckets[i]]++] = vertices[i];
+            }
+        });
+
+        //  a uniformly random permutation of each bucket, from its own stream, makes the whole permutation uniformly
+        //  random. The buckets are taken by the threads one by one
+        std::atomic<size_t> nextBucket{0};
+        runInRanges(numberOfVertices, numberOfRanges, [&](size_t, size_t, size_t) {
+            for (size_t bucket = nextBucket++; bucket < numberOfBuckets; bucket = nextBucket++) {
+                RandomGenerator(seed, bucket + 1).shuffle(
+                        shuffledVertices.begin() + static_cast<std::ptrdiff_t>(bucketStarts[bucket]),
+                        shuffledVertices.begin() + static_cast<std::ptrdiff_t>(bucketStarts[bucket + 1]));
+            }
+        });
+
+        vertices.swap(shuffledVertices);
+    }
+}
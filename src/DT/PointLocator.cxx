@@ -0,0 +1,121 @@
+/*
+ * Filename:    PointLocator.cxx
+ *
+ * Description: Source file of PointLocator class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <algorithm>
+#include <thread>
+#include "GeometricPredicates.hxx"
+#include "PointLocator.hxx"
+#include "SpatialSort.hxx"
+
+
+//  Fast lookup arrays to speed up the mesh manipulation primitives
+static constexpr int plus1mod3[3] = {1, 2, 0};
+
+//  ranges smaller than this are not worth a thread
+static constexpr size_t MIN_QUERIES_PER_THREAD = 4096;
+
+template <typename Predicates>
+PointLocator<Predicates>::PointLocator(const Mesh& mesh)
+        : mesh(mesh), triangleNeighbors(mesh.computeTriangleNeighbors())
+{
+}
+
+template <typename Predicates>
+PointLocator<Predicates>::~PointLocator() = default;
+
+template <typename Predicates>
+TriangleIndex PointLocator<Predicates>::walkToTriangle(const double* point, TriangleIndex& triangle) const
+{
+    TriangleIndex previousTriangle = NO_TRIANGLE;
+
+    bool walking = true;
+    while (walking) {
+        walking = false;
+
+        for (int edgeId = 0; edgeId < 3; ++edgeId) {
+            const TriangleIndex neighbor = triangleNeighbors[triangle][edgeId];
+
+            //  the edge we came from is already tested
+            if (neighbor == previousTriangle && neighbor != NO_TRIANGLE) {
+                continue;
+            }
+
+            const VertexIndex Pi = mesh.triangles[triangle][edgeId];
+            const VertexIndex Pj = mesh.triangles[triangle][plus1mod3[edgeId]];
+            const double pi[2] = {mesh.verticesX[Pi], mesh.verticesY[Pi]};
+            const double pj[2] = {mesh.verticesX[Pj], mesh.verticesY[Pj]};
+
+            //  triangles are clockwise, therefore the point is beyond PiPj if it lies on the left of PiPj
+            if (Predicates::orientation(pi, pj, point) > 0) {
+                //  the mesh is convex, therefore a point beyond a boundary edge is outside of it
+                if (neighbor == NO_TRIANGLE) {
+                    return NO_TRIANGLE;
+                }
+
+                previousTriangle = triangle;
+                triangle = neighbor;
+                walking = true;
+                break;
+            }
+        }
+    }
+
+    return triangle;
+}
+
+template <typename Predicates>
+TriangleIndex PointLocator<Predicates>::locate(const Vertex& point, TriangleIndex startTriangle) const
+{
+    if (mesh.triangles.empty()) {
+        return NO_TRIANGLE;
+    }
+
+    return walkToTriangle(point.coordinates, startTriangle);
+}
+
+template <typename Predicates>
+std::vector<TriangleIndex> PointLocator<Predicates>::locate(const std::vector<Vertex>& queries,
+                                                            unsigned numberOfThreads) const
+{
+    std::vector<TriangleIndex> triangles(queries.size(), NO_TRIANGLE);
+    if (mesh.triangles.empty() || queries.empty()) {
+        return triangles;
+    }
+
+    const std::vector<uint32_t> order = SpatialSort::computeHilbertOrder(queries);
+
+    //  each range walks from the triangle of its previous query, or from the last visited triangle of an outside one
+    const auto locateRange = [&](size_t first, size_t last) {
+        TriangleIndex triangle = 0;
+        for (size_t i = first; i < last; ++i) {
+            const uint32_t query = order[i];
+            triangles[query] = walkToTriangle(queries[query].coordinates, triangle);
+        }
+        GeometricPredicates::flushFilterStatistics();
+    };
+
+    const size_t numberOfRanges = std::clamp<size_t>(queries.size() / MIN_QUERIES_PER_THREAD, 1, numberOfThreads);
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfRanges - 1);
+    for (size_t range = 1; range < numberOfRanges; ++range) {
+        threads.emplace_back(locateRange, range * queries.size() / numberOfRanges,
+                             (range + 1) * queries.size() / numberOfRanges);
+    }
+    locateRange(0, queries.size() / numberOfRanges);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return triangles;
+}
+
+template class PointLocator<GeometricPredicates::Fast>;
+template class PointLocator<GeometricPredicates::Filtered>;
@@ -0,0 +1,90 @@
+/*
+ * Filename:    QuadEdgeMesh.cxx
+ *
+ * Description: Source file of QuadEdgeMesh class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include "QuadEdgeMesh.hxx"
+
+
+void QuadEdgeMesh::Allocator::absorb(Allocator& other)
+{
+    freeQuads.insert(freeQuads.end(), other.freeQuads.begin(), other.freeQuads.end());
+    for (uint32_t quadIndex = other.nextQuad; quadIndex < other.endQuad; ++quadIndex) {
+        freeQuads.push_back(quadIndex);
+    }
+
+    other.freeQuads.clear();
+    other.nextQuad = other.endQuad = 0;
+}
+
+QuadEdgeMesh::QuadEdgeMesh() : chunks(MAX_CHUNKS)
+{
+}
+
+QuadEdgeMesh::~QuadEdgeMesh() = default;
+
+EdgeIndex QuadEdgeMesh::makeEdge(VertexIndex origin, VertexIndex destination, Allocator& allocator)
+{
+    uint32_t quadIndex;
+    if (!allocator.freeQuads.empty()) {
+        quadIndex = allocator.freeQuads.back();
+        allocator.freeQuads.pop_back();
+    } else {
+        if (allocator.nextQuad == allocator.endQuad) {
+            //  the last quad of the last chunk is not used, because its last edge would be NO_EDGE
+            const uint32_t chunk = numberOfChunks.fetch_add(1);
+            if (chunk >= MAX_CHUNKS - 1) {
+                throw std::length_error("QuadEdgeMesh: too many edges for 32-bit edge indices");
+            }
+
+            //  unused slots are marked as such, so that a linear scan of the chunks can skip them
+            chunks[chunk] = std::make_unique<QuadEdge[]>(CHUNK_SIZE);
+            std::fill_n(chunks[chunk].get(), CHUNK_SIZE, QuadEdge{{}, {NO_VERTEX, NO_VERTEX}});
+
+            allocator.nextQuad = chunk << CHUNK_BITS;
+            allocator.endQuad = allocator.nextQuad + CHUNK_SIZE;
+        }
+        quadIndex = allocator.nextQuad++;
+    }
+
+    const EdgeIndex e = quadIndex << 2u;
+    QuadEdge& quadEdge = quad(e);
+    quadEdge.next = {e, e + 3, e + 2, e + 1};
+    quadEdge.origin = {origin, destination};
+
+    return e;
+}
+
+EdgeIndex QuadEdgeMesh::connect(EdgeIndex a, EdgeIndex b, Allocator& allocator)
+{
+    const EdgeIndex e = makeEdge(dest(a), org(b), allocator);
+
+    splice(e, lnext(a));
+    splice(sym(e), b);
+
+    return e;
+}
+
+void QuadEdgeMesh::deleteEdge(EdgeIndex e, Allocator& allocator)
+{
+    splice(e, oprev(e));
+    splice(sym(e), oprev(sym(e)));
+
+    quad(e).origin = {NO_VERTEX, NO_VERTEX};
+    allocator.freeQuads.push_back(e >> 2u);
+}
+
+void QuadEdgeMesh::release()
+{
+    const uint32_t allocatedChunks = std::min(numberOfChunks.load(), MAX_CHUNKS);
+    for (uint32_t chunk = 0; chunk < allocatedChunks; ++chunk) {
+        chunks[chunk].reset();
+    }
+    numberOfChunks = 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * Filename:    SpatialSort.cxx
+ *
+ * Description: Source file of namespace SpatialSort.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include "SpatialSort.hxx"
+
+
+namespace SpatialSort
+{
+    //  rounds smaller than this are sorted together with the next round
+    constexpr size_t MIN_ROUND_SIZE = 64;
+
+    uint64_t hilbertIndex(uint32_t x, uint32_t y)
+    {
+        uint64_t index = 0;
+        for (uint64_t s = uint64_t(1) << 31u; s > 0; s >>= 1u) {
+            const uint64_t rx = (x & s) > 0;
+            const uint64_t ry = (y & s) > 0;
+            index += s * s * ((3 * rx) ^ ry);
+
+            //  rotate the quadrant, only the lower bits are used from now on
+            if (ry == 0) {
+                if (rx == 1) {
+                    x = ~x;
+                    y = ~y;
+                }
+                std::swap(x, y);
+            }
+        }
+        return index;
+    }
+
+    /**
+     * @brief Computes the indices of a range of vertices along the Hilbert curve of the bounding box of the range.
+     *
+     * @param vertices are the vertices
+     * @param first is the first vertex of the range
+     * @param last is the vertex after the last vertex of the range
+     * @return the indices along the Hilbert curve of the vertices of the range
+     */
+    static std::vector<uint64_t> computeHilbertIndices(const std::vector<Vertex>& vertices, size_t first, size_t last)
+    {
+        auto [minX, maxX] = std::minmax_element(vertices.begin() + first, vertices.begin() + last,
+                                                [](const Vertex& a, const Vertex& b) { return a[0] < b[0]; });
+        auto [minY, maxY] = std::minmax_element(vertices.begin() + first, vertices.begin() + last,
+                                                [](const Vertex& a, const Vertex& b) { return a[1] < b[1]; });
+        const double originX = (*minX)[0];
+        const double originY = (*minY)[1];
+        const double width = std::max((*maxX)[0] - originX, (*maxY)[1] - originY);
+
+        //  map the bounding box to the 2^32 x 2^32 grid, keeping the aspect ratio
+        const double scale = width > 0 ? 4294967295.0 / width : 0;
+
+        std::vector<uint64_t> indices;
+        indices.reserve(last - first);
+        for (size_t i = first; i < last; ++i) {
+            const auto x = static_cast<uint32_t>(std::lround((vertices[i][0] - originX) * scale));
+            const auto y = static_cast<uint32_t>(std::lround((vertices[i][1] - originY) * scale));
+            indices.push_back(hilbertIndex(x, y));
+        }
+
+        return indices;
+    }
+
+    void sortAlongHilbertCurve(std::vector<Vertex>& vertices, size_t first, size_t last)
+    {
+        if (last - first < 2) {
+            return;
+        }
+
+        const std::vector<uint64_t> indices = computeHilbertIndices(vertices, first, last);
+
+        std::vector<std::pair<uint64_t, Vertex>> indexedVertices;
+        indexedVertices.reserve(last - first);
+        for (size_t i = first; i < last; ++i) {
+            indexedVertices.emplace_back(indices[i - first], vertices[i]);
+        }
+
+        std::sort(indexedVertices.begin(), indexedVertices.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        for (size_t i = first; i < last; ++i) {
+            vertices[i] = indexedVertices[i - first].second;
+        }
+    }
+
+    std::vector<uint32_t> computeHilbertOrder(const std::vector<Vertex>& vertices)
+    {
+        if (vertices.empty()) {
+            return {};
+        }
+
+        const std::vector<uint64_t> indices = computeHilbertIndices(vertices, 0, vertices.size());
+
+        //  the indices are sorted together with the vertices, not looked up through them
+        std::vector<std::pair<uint64_t, uint32_t>> indexedOrder(vertices.size());
+        for (uint32_t i = 0; i < indexedOrder.size(); ++i) {
+            indexedOrder[i] = {indices[i], i};
+        }
+        std::sort(indexedOrder.begin(), indexedOrder.end());
+
+        std::vector<uint32_t> order(vertices.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = indexedOrder[i].second;
+        }
+
+        return order;
+    }
+
+    void computeBiasedRandomizedInsertionOrder(std::vector<Vertex>& vertices)
+    {
+        size_t last = vertices.size();
+        while (last > MIN_ROUND_SIZE) {
+            const size_t first = last / 2;
+            sortAlongHilbertCurve(vertices, first, last);
+            last = first;
+        }
+        sortAlongHilbertCurve(vertices, 0, last);
+    }
+}
@@ -0,0 +1,499 @@
+/*
+ * Filename:    SweepHullTriangulation.cxx
+ *
+ * Description: Source file of SweepHullTriangulation class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <algorithm>
+#include "GeometricPredicates.hxx"
+#include "MemoryUsage.hxx"
+#include "SweepHullTriangulation.hxx"
+
+
+//  Fast lookup arrays to speed up the mesh manipulation primitives
+static constexpr int plus1mod3[3] = {1, 2, 0};
+static constexpr int minus1mod3[3] = {2, 0, 1};
+
+////////////////////////////////////////////////////////////
+//                    Neighbor Codes                      //
+////////////////////////////////////////////////////////////
+
+static inline TriangleIndex neighborCode(TriangleIndex triangle, int edgeId)
+{
+    return (triangle << 2u) | static_cast<TriangleIndex>(edgeId);
+}
+
+static inline TriangleIndex neighborTriangle(TriangleIndex neighbor)
+{
+    return neighbor >> 2u;
+}
+
+static inline int neighborEdgeId(TriangleIndex neighbor)
+{
+    return static_cast<int>(neighbor & 3u);
+}
+
+template <typename Predicates>
+SweepHullTriangulation<Predicates>::SweepHullTriangulation() : Triangulation(Predicates::robust)
+{
+}
+
+template <typename Predicates>
+SweepHullTriangulation<Predicates>::~SweepHullTriangulation() = default;
+
+template <typename Predicates>
+void SweepHullTriangulation<Predicates>::setInputVertices(std::vector<Vertex>& vertices, unsigned numberOfThreads)
+{
+    removeDuplicatesAndShuffle(vertices, InsertionOrder::BRIO, numberOfThreads);
+
+    //  extract unique vertices. Cost O(n)
+    verticesX.clear();
+    verticesY.clear();
+    verticesX.reserve(vertices.size());
+    verticesY.reserve(vertices.size());
+    inputPositions.clear();
+    inputPositions.reserve(vertices.size());
+    for (const auto& vertex : vertices) {
+        verticesX.push_back(vertex[0]);
+        verticesY.push_back(vertex[1]);
+        inputPositions.push_back(static_cast<VertexIndex>(vertex.id));
+    }
+}
+
+template <typename Predicates>
+double SweepHullTriangulation<Predicates>::orientation(VertexIndex a, VertexIndex b, VertexIndex c) const
+{
+    const double pa[2] = {verticesX[a], verticesY[a]};
+    const double pb[2] = {verticesX[b], verticesY[b]};
+    const double pc[2] = {verticesX[c], verticesY[c]};
+
+    return Predicates::orientation(pa, pb, pc);
+}
+
+template <typename Predicates>
+TriangleIndex SweepHullTriangulation<Predicates>::createTriangle(VertexIndex Pi, VertexIndex Pj, VertexIndex Pk)
+{
+    const auto triangle = static_cast<TriangleIndex>(triangleVertices.size());
+
+    triangleVertices.push_back({Pi, Pj, Pk});
+    triangleNeighbors.push_back({NO_NEIGHBOR, NO_NEIGHBOR, NO_NEIGHBOR});
+
+    lastCreatedTriangle = triangle;
+
+    return triangle;
+}
+
+template <typename Predicates>
+void SweepHullTriangulation<Predicates>::setNeighbor(TriangleIndex triangle, int edgeId, TriangleIndex neighbor)
+{
+    triangleNeighbors[triangle][edgeId] = neighbor;
+    if (neighbor != NO_NEIGHBOR) {
+        triangleNeighbors[neighborTriangle(neighbor)][neighborEdgeId(neighbor)] = neighborCode(triangle, edgeId);
+    } else {
+        //  the clockwise edge PiPj lies on the convex hull, whose counterclockwise edge PjPi starts from Pj
+        hullTriangle[triangleVertices[triangle][plus1mod3[edgeId]]] = neighborCode(triangle, edgeId);
+    }
+}
+
+template <typename Predicates>
+VertexIndex SweepHullTriangulation<Predicates>::createInitialTriangulation()
+{
+    const auto numberOfVertices = static_cast<VertexIndex>(verticesX.size());
+
+    //  find the first vertex that is not collinear with the first two
+    VertexIndex apex = 2;
+    while (apex < numberOfVertices && orientation(0, 1, apex) == 0) {
+        ++apex;
+    }
+    if (apex >= numberOfVertices) {
+        return 0;
+    }
+
+    //  the collinear vertices are sorted along their line, which is their lexicographic order. Their input
+    //  positions move with them.
+    if (apex > 2) {
+        std::vector<std::pair<std::array<double, 2>, VertexIndex>> collinearVertices(apex);
+        for (VertexIndex vertex = 0; vertex < apex; ++vertex) {
+            collinearVertices[vertex] = {{verticesX[vertex], verticesY[vertex]}, inputPositions[vertex]};
+        }
+        std::sort(collinearVertices.begin(), collinearVertices.end());
+        for (VertexIndex vertex = 0; vertex < apex; ++vertex) {
+            verticesX[vertex] = collinearVertices[vertex].first[0];
+            verticesY[vertex] = collinearVertices[vertex].first[1];
+            inputPositions[vertex] = collinearVertices[vertex].second;
+        }
+    }
+
+    /*
+     *  the collinear vertices P0, ..., Pk-1 are sorted along their line, therefore they are connected to the apex Pk
+     *  with a fan of triangles. Every other vertex of the fan lies on the line, outside of the circumcircle of each
+     *  triangle, therefore the fan is Delaunay.
+     */
+    const bool apexLeftOfLine = orientation(0, 1, apex) > 0;
+
+    TriangleIndex previousTriangle = NO_NEIGHBOR;
+    for (VertexIndex vertex = 0; vertex + 1 < apex; ++vertex) {
+        TriangleIndex triangle;
+        if (apexLeftOfLine) {
+            //  clockwise triangle (Pv+1, Pv, Pk); its edge Pv Pk is shared with the previous triangle
+            triangle = createTriangle(vertex + 1, vertex, apex);
+            setNeighbor(triangle, 0, NO_NEIGHBOR);
+            if (previousTriangle != NO_NEIGHBOR) {
+                setNeighbor(triangle, 1, neighborCode(previousTriangle, 2));
+            }
+            hullNext[vertex] = vertex + 1;
+            hullPrevious[vertex + 1] = vertex;
+        } else {
+            //  clockwise triangle (Pv, Pv+1, Pk); its edge Pk Pv is shared with the previous triangle
+            triangle = createTriangle(vertex, vertex + 1, apex);
+            setNeighbor(triangle, 0, NO_NEIGHBOR);
+            if (previousTriangle != NO_NEIGHBOR) {
+                setNeighbor(triangle, 2, neighborCode(previousTriangle, 1));
+            }
+            hullNext[vertex + 1] = vertex;
+            hullPrevious[vertex] = vertex + 1;
+        }
+        previousTriangle = triangle;
+    }
+
+    //  close the hull through the apex
+    const TriangleIndex firstTriangle = 0;
+    const TriangleIndex lastTriangle = previousTriangle;
+    if (apexLeftOfLine) {
+        setNeighbor(firstTriangle, 1, NO_NEIGHBOR);
+        setNeighbor(lastTriangle, 2, NO_NEIGHBOR);
+        hullNext[apex - 1] = apex;
+        hullPrevious[apex] = apex - 1;
+        hullNext[apex] = 0;
+        hullPrevious[0] = apex;
+    } else {
+        setNeighbor(firstTriangle, 2, NO_NEIGHBOR);
+        setNeighbor(lastTriangle, 1, NO_NEIGHBOR);
+        hullNext[apex] = apex - 1;
+        hullPrevious[apex - 1] = apex;
+        hullNext[0] = apex;
+        hullPrevious[apex] = 0;
+    }
+
+    return apex + 1;
+}
+
+
+template <typename Predicates>
+void SweepHullTriangulation<Predicates>::insertVertex(VertexIndex vertex)
+{
+    TriangleIndex triangle = lastCreatedTriangle;
+    TriangleIndex previousTriangle = NO_NEIGHBOR;
+
+    bool walking = true;
+    while (walking) {
+        walking = false;
+
+        const int firstEdgeId = static_cast<int>(walkRandomGenerator() % 3);
+        for (int i = 0; i < 3; ++i) {
+            const int edgeId = (firstEdgeId + i) % 3;
+            const TriangleIndex neighbor = triangleNeighbors[triangle][edgeId];
+
+            //  the edge we came from is already tested
+            if (neighbor != NO_NEIGHBOR && neighborTriangle(neighbor) == previousTriangle) {
+                continue;
+            }
+
+            //  triangles are clockwise, therefore the vertex is beyond PiPj if it lies on the left of PiPj
+            const VertexIndex Pi = triangleVertices[triangle][edgeId];
+            const VertexIndex Pj = triangleVertices[triangle][plus1mod3[edgeId]];
+            if (orientation(Pi, Pj, vertex) > 0) {
+                //  the vertex sees the hull edge PjPi
+                if (neighbor == NO_NEIGHBOR) {
+                    insertVertexOutsideHull(vertex, Pj);
+                    return;
+                }
+
+                previousTriangle = triangle;
+                triangle = neighborTriangle(neighbor);
+                walking = true;
+                break;
+            }
+        }
+    }
+
+    const auto& Pijk = triangleVertices[triangle];
+    const std::array<double, 3> orientationTests = {orientation(Pijk[0], Pijk[1], vertex),
+                                                    orientation(Pijk[1], Pijk[2], vertex),
+                                                    orientation(Pijk[2], Pijk[0], vertex)};
+    insertVertexInTriangle(vertex, triangle, orientationTests);
+}
+
+template <typename Predicates>
+void SweepHullTriangulation<Predicates>::insertVertexOutsideHull(VertexIndex vertex, VertexIndex hullVertex)
+{
+    //  the visible hull edges are contiguous, therefore they are found by walking both ways from a visible one
+    VertexIndex first = hullVertex;
+    VertexIndex last = hullNext[hullVertex];
+    while (orientation(last, hullNext[last], vertex) < 0) {
+        last = hullNext[last];
+    }
+    while (orientation(hullPrevious[first], first, vertex) < 0) {
+        first = hullPrevious[first];
+    }
+
+    //  connect the vertex with the visible hull edges from first to last
+    TriangleIndex firstTriangle = NO_NEIGHBOR;
+    TriangleIndex previousTriangle = NO_NEIGHBOR;
+    for (VertexIndex Pi = first; Pi != last;) {
+        const VertexIndex Pj = hullNext[Pi];
+
+        //  clockwise triangle (Pi, Pj, Pr), because the new vertex Pr lies right of the counterclockwise edge PiPj
+        const TriangleIndex PiPjPr = createTriangle(Pi, Pj, vertex);
+        setNeighbor(PiPjPr, 0, hullTriangle[Pi]);
+        if (previousTriangle != NO_NEIGHBOR) {
+            setNeighbor(PiPjPr, 2, neighborCode(previousTriangle, 1));
+        } else {
+            firstTriangle = PiPjPr;
+        }
+        legalizationStack.push_back(neighborCode(PiPjPr, 0));
+
+        previousTriangle = PiPjPr;
+        Pi = Pj;
+    }
+
+    //  replace the visible hull edges with the two edges of the new vertex
+    setNeighbor(firstTriangle, 2, NO_NEIGHBOR);
+    setNeighbor(previousTriangle, 1, NO_NEIGHBOR);
+    hullNext[first] = vertex;
+    hullPrevious[vertex] = first;
+    hullNext[vertex] = last;
+    hullPrevious[last] = vertex;
+
+    legalizeEdges();
+}
+
+template <typename Predicates>
+void SweepHullTriangulation<Predicates>::insertVertexInTriangle(VertexIndex vertex, TriangleIndex triangle,
+                                                                const std::array<double, 3>& orientationTests)
+{
+    const int edgeId = orientationTests[0] == 0 ? 0 : orientationTests[1] == 0 ? 1 : orientationTests[2] == 0 ? 2 : -1;
+    if (edgeId == -1) {
+        const auto [Pi, Pj, Pk] = triangleVertices[triangle];
+        const auto [PiPjNeighbor, PjPkNeighbor, PkPiNeighbor] = triangleNeighbors[triangle];
+
+        //  the vertex Pr lies inside PiPjPk, which is split to PiPjPr, PjPkPr, and PkPiPr
+        const TriangleIndex PiPjPr = triangle;
+        triangleVertices[PiPjPr] = {Pi, Pj, vertex};
+        const TriangleIndex PjPkPr = createTriangle(Pj, Pk, vertex);
+        const TriangleIndex PkPiPr = createTriangle(Pk, Pi, vertex);
+
+        setNeighbor(PiPjPr, 0, PiPjNeighbor);
+        setNeighbor(PiPjPr, 1, neighborCode(PjPkPr, 2));
+        setNeighbor(PiPjPr, 2, neighborCode(PkPiPr, 1));
+        setNeighbor(PjPkPr, 0, PjPkNeighbor);
+        setNeighbor(PjPkPr, 1, neighborCode(PkPiPr, 2));
+        setNeighbor(PkPiPr, 0, PkPiNeighbor);
+
+        legalizationStack.push_back(neighborCode(PiPjPr, 0));
+        legalizationStack.push_back(neighborCode(PjPkPr, 0));
+        legalizationStack.push_back(neighborCode(PkPiPr, 0));
+        legalizeEdges();
+        return;
+    }
+
+    //  the vertex Pr lies on the edge PaPb of PaPbPc
+    const VertexIndex Pa = triangleVertices[triangle][edgeId];
+    const VertexIndex Pb = triangleVertices[triangle][plus1mod3[edgeId]];
+    const VertexIndex Pc = triangleVertices[triangle][minus1mod3[edgeId]];
+    const TriangleIndex PaPbNeighbor = triangleNeighbors[triangle][edgeId];
+    const TriangleIndex PbPcNeighbor = triangleNeighbors[triangle][plus1mod3[edgeId]];
+    const TriangleIndex PcPaNeighbor = triangleNeighbors[triangle][minus1mod3[edgeId]];
+
+    //  PaPbPc is split to PaPrPc and PrPbPc
+    const TriangleIndex PaPrPc = triangle;
+    triangleVertices[PaPrPc] = {Pa, vertex, Pc};
+    const TriangleIndex PrPbPc = createTriangle(vertex, Pb, Pc);
+
+    setNeighbor(PaPrPc, 1, neighborCode(PrPbPc, 2));
+    setNeighbor(PaPrPc, 2, PcPaNeighbor);
+    setNeighbor(PrPbPc, 1, PbPcNeighbor);
+
+    if (PaPbNeighbor == NO_NEIGHBOR) {
+        //  the edge lies on the hull, whose counterclockwise edge PbPa is split by the vertex
+        setNeighbor(PaPrPc, 0, NO_NEIGHBOR);
+        setNeighbor(PrPbPc, 0, NO_NEIGHBOR);
+        hullNext[Pb] = vertex;
+        hullPrevious[vertex] = Pb;
+        hullNext[vertex] = Pa;
+        hullPrevious[Pa] = vertex;
+    } else {
+        //  the adjacent triangle PbPaPd is split to PbPrPd and PrPaPd
+        const TriangleIndex PbPaPd = neighborTriangle(PaPbNeighbor);
+        const int PbPaId = neighborEdgeId(PaPbNeighbor);
+        const VertexIndex Pd = triangleVertices[PbPaPd][minus1mod3[PbPaId]];
+        const TriangleIndex PaPdNeighbor = triangleNeighbors[PbPaPd][plus1mod3[PbPaId]];
+        const TriangleIndex PdPbNeighbor = triangleNeighbors[PbPaPd][minus1mod3[PbPaId]];
+
+        const TriangleIndex PbPrPd = PbPaPd;
+        triangleVertices[PbPrPd] = {Pb, vertex, Pd};
+        const TriangleIndex PrPaPd = createTriangle(vertex, Pa, Pd);
+
+        setNeighbor(PbPrPd, 0, neighborCode(PrPbPc, 0));
+        setNeighbor(PbPrPd, 1, neighborCode(PrPaPd, 2));
+        setNeighbor(PbPrPd, 2, PdPbNeighbor);
+        setNeighbor(PrPaPd, 0, neighborCode(PaPrPc, 0));
+        setNeighbor(PrPaPd, 1, PaPdNeighbor);
+
+        legalizationStack.push_back(neighborCode(PbPrPd, 2));
+        legalizationStack.push_back(neighborCode(PrPaPd, 1));
+    }
+
+    legalizationStack.push_back(neighborCode(PaPrPc, 2));
+    legalizationStack.push_back(neighborCode(PrPbPc, 1));
+    legalizeEdges();
+}
+
+template <typename Predicates>
+void SweepHullTriangulation<Predicates>::legalizeEdges()
+{
+    while (!legalizationStack.empty()) {
+        const TriangleIndex PiPjPr = neighborTriangle(legalizationStack.back());
+        const int edgeId = neighborEdgeId(legalizationStack.back());
+        legalizationStack.pop_back();
+
+        const TriangleIndex neighbor = triangleNeighbors[PiPjPr][edgeId];
+        if (neighbor == NO_NEIGHBOR) {
+            continue;
+        }
+
+        /*
+         *                                  Pk
+         *                                  /\
+         *                                 /  \
+         *                                /    \
+         *                               /      \
+         *                              /        \
+         *                             /          \
+         *                            /            \
+         *                           /              \
+         *                        Pi ---------------- Pj
+         *                            \            /
+         *                             \          /
+         *                              \        /
+         *                               \      /
+         *                                \    /
+         *                                 \  /
+         *                                  \/
+         *                                  Pr
+         */
+
+        //  find adjacent triangle of edge PiPj, whose edge PjPi has id neighborEdgeId
+        const TriangleIndex PiPkPj = neighborTriangle(neighbor);
+        const int PjPiId = neighborEdgeId(neighbor);
+
+        const VertexIndex Pi = triangleVertices[PiPjPr][edgeId];
+        const VertexIndex Pj = triangleVertices[PiPjPr][plus1mod3[edgeId]];
+        const VertexIndex Pr = triangleVertices[PiPjPr][minus1mod3[edgeId]];
+        const VertexIndex Pk = triangleVertices[PiPkPj][minus1mod3[PjPiId]];
+
+        const double pi[2] = {verticesX[Pi], verticesY[Pi]};
+        const double pj[2] = {verticesX[Pj], verticesY[Pj]};
+        const double pr[2] = {verticesX[Pr], verticesY[Pr]};
+        const double pk[2] = {verticesX[Pk], verticesY[Pk]};
+
+        //  Check if PiPj is illegal
+        if (Predicates::inCircle(pi, pj, pr, pk)) {
+            ////////////////////////////////////////////////////////////////
+            //                      Flip Edge Started                     //
+            ////////////////////////////////////////////////////////////////
+            ++numberOfFlips;
+
+            //  Find neighbors of PiPjPr and PiPkPj
+            const TriangleIndex PjPrNeighbor = triangleNeighbors[PiPjPr][plus1mod3[edgeId]];
+            const TriangleIndex PrPiNeighbor = triangleNeighbors[PiPjPr][minus1mod3[edgeId]];
+
+            const TriangleIndex PiPkNeighbor = triangleNeighbors[PiPkPj][plus1mod3[PjPiId]];
+            const TriangleIndex PkPjNeighbor = triangleNeighbors[PiPkPj][minus1mod3[PjPiId]];
+
+            //  reuse the slots of the flipped triangles: PiPjPr becomes PiPkPr and PiPkPj becomes PkPjPr
+            const TriangleIndex PiPkPr = PiPjPr;
+            const TriangleIndex PkPjPr = PiPkPj;
+            triangleVertices[PiPkPr] = {Pi, Pk, Pr};
+            triangleVertices[PkPjPr] = {Pk, Pj, Pr};
+
+            //  assign neighbors of PiPkPr
+            setNeighbor(PiPkPr, 0, PiPkNeighbor);
+            setNeighbor(PiPkPr, 1, neighborCode(PkPjPr, 2));
+            setNeighbor(PiPkPr, 2, PrPiNeighbor);
+
+            //  assign neighbors of PkPjPr
+            setNeighbor(PkPjPr, 0, PkPjNeighbor);
+            setNeighbor(PkPjPr, 1, PjPrNeighbor);
+
+            ////////////////////////////////////////////////////////////////
+            //                       Flip Edge Ended                      //
+            ////////////////////////////////////////////////////////////////
+
+            //  PiPk is legalized before PkPj, like a depth-first recursion would
+            legalizationStack.push_back(neighborCode(PkPjPr, 0));
+            legalizationStack.push_back(neighborCode(PiPkPr, 0));
+        }
+    }
+}
+
+template <typename Predicates>
+void SweepHullTriangulation<Predicates>::generateMesh()
+{
+    std::cout << std::endl << "Compute Delaunay Triangulation..." << std::endl;
+
+    meshingTimer.startTimer();
+    numberOfFlips = 0;
+
+    const auto numberOfVertices = static_cast<VertexIndex>(verticesX.size());
+
+    //  a triangulation of n vertices has at most 2n - 5 triangles
+    triangleVertices.reserve(2 * static_cast<size_t>(numberOfVertices));
+    triangleNeighbors.reserve(2 * static_cast<size_t>(numberOfVertices));
+
+    hullNext.assign(numberOfVertices, NO_VERTEX);
+    hullPrevious.assign(numberOfVertices, NO_VERTEX);
+    hullTriangle.assign(numberOfVertices, NO_NEIGHBOR);
+
+    if (numberOfVertices >= 3) {
+        for (VertexIndex vertex = createInitialTriangulation(); vertex != 0 && vertex < numberOfVertices; ++vertex) {
+            insertVertex(vertex);
+        }
+    }
+
+    createOutputMesh();
+
+    std::cout << std::endl << "Mesh Vertices: " << outputMesh.verticesX.size() << std::endl;
+    std::cout << "Mesh Triangles: " << outputMesh.triangles.size() << std::endl;
+
+    meshingTimer.stopTimer();
+}
+
+template <typename Predicates>
+void SweepHullTriangulation<Predicates>::createOutputMesh()
+{
+    std::cout << std::endl << "Compute Mesh Results..." << std::endl;
+
+    outputMesh = Mesh();
+
+    //  every stored triangle belongs to the mesh
+    outputMesh.triangles = std::move(triangleVertices);
+    outputMesh.verticesX = std::move(verticesX);
+    outputMesh.verticesY = std::move(verticesY);
+    outputMesh.inputPositions = std::move(inputPositions);
+
+    triangleVertices = std::vector<std::array<VertexIndex, 3>>();
+    triangleNeighbors = std::vector<std::array<TriangleIndex, 3>>();
+    hullNext = std::vector<VertexIndex>();
+    hullPrevious = std::vector<VertexIndex>();
+    hullTriangle = std::vector<TriangleIndex>();
+    legalizationStack = std::vector<TriangleIndex>();
+
+    MemoryUsage::releaseFreeMemory();
+}
+
+template class SweepHullTriangulation<GeometricPredicates::Fast>;
+template class SweepHullTriangulation<GeometricPredicates::Filtered>;
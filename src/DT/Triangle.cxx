@@ -15,20 +15,21 @@ Triangle::Triangle(std::array<VertexHandle, 3> vertices)
     for (size_t i = 0; i < vertices.size(); ++i) {
         this->vertices[i] = vertices[i];
     }
-    edges.fill(nullptr);
-    childrenTriangles.reserve(3);
+    neighbors.fill(nullptr);
+    neighborEdgeIds.fill(0);
+    dagNode = 0;
     visitedTriangle = false;
 }
 
-Triangle::~Triangle()
-{
-    childrenTriangles.clear();
-}
+Triangle::~Triangle() = default;
 
-void Triangle::setEdges(std::array<EdgeHandle, 3> edges)
+void Triangle::setNeighbor(int edgeId, const TriangleHandle& neighbor, int neighborEdgeId)
 {
-    for (size_t i = 0; i < edges.size(); ++i) {
-        this->edges[i] = edges[i];
+    neighbors[edgeId] = neighbor;
+    neighborEdgeIds[edgeId] = static_cast<unsigned char>(neighborEdgeId);
+    if (neighbor != nullptr) {
+        neighbor->neighbors[neighborEdgeId] = this;
+        neighbor->neighborEdgeIds[neighborEdgeId] = static_cast<unsigned char>(edgeId);
     }
 }
 
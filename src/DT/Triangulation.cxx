@@ -0,0 +1,333 @@
+/*
+ * Filename:    Triangulation.cxx
+ *
+ * Description: Source file of Triangulation class.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+#include "GeometricPredicates.hxx"
+#include "ParallelSort.hxx"
+#include "RandomGenerator.hxx"
+#include "SpatialSort.hxx"
+#include "Triangulation.hxx"
+
+
+//  ranges smaller than this are not worth a thread
+static constexpr TriangleIndex MIN_TRIANGLES_PER_THREAD = 4096;
+
+Triangulation::Triangulation(bool robustPredicates) : robustPredicates(robustPredicates)
+{
+    GeometricPredicates::initialize();
+}
+
+Triangulation::~Triangulation() = default;
+
+void Triangulation::setDuplicateRemoval(DuplicateRemoval duplicateRemoval)
+{
+    this->duplicateRemoval = duplicateRemoval;
+}
+
+void Triangulation::setSeed(uint64_t seed)
+{
+    this->seed = seed;
+}
+
+size_t Triangulation::getNumberOfDuplicateVertices() const
+{
+    return numberOfDuplicateVertices;
+}
+
+uint64_t Triangulation::getNumberOfFlips() const
+{
+    return numberOfFlips;
+}
+
+const std::vector<std::pair<size_t, size_t>>& Triangulation::getDuplicateVertices() const
+{
+    return duplicateVertices;
+}
+
+void Triangulation::setInputPositions(std::vector<Vertex>& vertices)
+{
+    //  the ids travel with the vertices through the sort, the duplicate removal, and the shuffle
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        vertices[i].id = static_cast<int>(i);
+    }
+}
+
+void Triangulation::removeDuplicatesByHashing(std::vector<Vertex>& vertices)
+{
+    setInputPositions(vertices);
+
+    //  remove duplicate vertices in the order of the input. Expected cost: O(n)
+    ParallelSort::removeDuplicatesByHashing(vertices, duplicateVertices);
+    numberOfDuplicateVertices = duplicateVertices.size();
+
+    std::cout << "Duplicate vertices: " << numberOfDuplicateVertices << std::endl;
+}
+
+void Triangulation::sortAndRemoveDuplicates(std::vector<Vertex>& vertices, unsigned numberOfThreads)
+{
+    if (duplicateRemoval == DuplicateRemoval::Hash) {
+        removeDuplicatesByHashing(vertices);
+
+        //  sort vertices lexicographically in descending order with a radix sort. Cost: O(n)
+        ParallelSort::sortLexicographically(vertices, numberOfThreads);
+        return;
+    }
+
+    setInputPositions(vertices);
+
+    //  sort vertices lexicographically in descending order with a radix sort. Cost: O(n)
+    ParallelSort::sortLexicographically(vertices, numberOfThreads);
+
+    //  remove duplicate vertices. Cost: O(n)
+    const size_t numberOfInputVertices = vertices.size();
+    ParallelSort::removeDuplicates(vertices, numberOfThreads);
+    numberOfDuplicateVertices = numberOfInputVertices - vertices.size();
+    duplicateVertices.clear();
+
+    std::cout << "Duplicate vertices: " << numberOfDuplicateVertices << std::endl;
+}
+
+void Triangulation::removeDuplicatesAndShuffle(std::vector<Vertex>& vertices, InsertionOrder insertionOrder,
+                                               unsigned numberOfThreads)
+{
+    //  the shuffle discards the order of the vertices, therefore hashing does not sort them
+    if (duplicateRemoval == DuplicateRemoval::Hash) {
+        std::cout << std::endl << "Remove duplicates by hashing, and Shuffle Vertices..." << std::endl;
+
+        removeDuplicatesByHashing(vertices);
+    } else {
+        std::cout << std::endl << "Sort lexicographically, Remove duplicates, and Shuffle Vertices..."
+                  << std::endl;
+
+        sortAndRemoveDuplicates(vertices, numberOfThreads);
+    }
+
+    //  compute a random permutation of the vertices
+    //  Note: if shuffle is not activated, the complexity of the algorithm becomes: O(n^2).
+    ParallelSort::shuffle(vertices, RandomGenerator(seed, RandomStream::InsertionOrder)(), numberOfThreads);
+
+    //  sort the rounds of the permutation along the Hilbert curve. Cost: O(n log n)
+    if (insertionOrder == InsertionOrder::BRIO) {
+        std::cout << std::endl << "Compute Biased Randomized Insertion Order..." << std::endl;
+
+        SpatialSort::computeBiasedRandomizedInsertionOrder(vertices);
+    }
+}
+
+void Triangulation::validateDelaunayTriangulation(unsigned numberOfThreads)
+{
+    validateDelaunayTriangulationTimer.startTimer();
+
+    std::cout << std::endl << "Validating Delaunay property..." << std::endl;
+
+    const auto numberOfVertices = static_cast<VertexIndex>(outputMesh.verticesX.size());
+    const auto numberOfTriangles = static_cast<TriangleIndex>(outputMesh.triangles.size());
+
+    //  the neighbors can only be computed from valid vertex indices
+    bool validTopology = true;
+    for (TriangleIndex triangle = 0; triangle < numberOfTriangles; ++triangle) {
+        const auto& [Pi, Pj, Pk] = outputMesh.triangles[triangle];
+        if (Pi >= numberOfVertices || Pj >= numberOfVertices || Pk >= numberOfVertices || Pi == Pj || Pj == Pk ||
+            Pk == Pi) {
+            std::cout << "Triangle " << triangle << " has invalid vertex indices." << std::endl;
+            validTopology = false;
+        }
+    }
+    if (!validTopology) {
+        std::cout << std::endl << "Triangulation is not valid" << std::endl;
+        validateDelaunayTriangulationTimer.stopTimer();
+        return;
+    }
+
+    const std::vector<std::array<TriangleIndex, 3>> triangleNeighbors = outputMesh.computeTriangleNeighbors();
+
+    //  results of the validation of a range of triangles, reported in the order of the ranges
+    struct RangeValidation
+    {
+        std::ostringstream report;
+        bool validTopology = true;
+        bool validDelaunay = true;
+        TriangleIndex numberOfBoundaryEdges = 0;
+    };
+
+    const auto vertex = [this](VertexIndex vertexIndex) {
+        return Vertex({outputMesh.verticesX[vertexIndex], outputMesh.verticesY[vertexIndex]});
+    };
+
+    //  Each triangle must be clockwise and each of its neighbors must have it as neighbor across the same edge. Then
+    //  the mesh is a consistently oriented manifold, and if its boundary is convex, it is Delaunay if each edge is
+    //  locally Delaunay, i.e. the vertex of the neighbor that is opposite of the edge does not lie in the circumcircle
+    //  of the triangle. The convexity of the boundary is checked after the triangles.
+    const auto validateRange = [&](TriangleIndex first, TriangleIndex last, RangeValidation& validation) {
+        for (TriangleIndex triangle = first; triangle < last; ++triangle) {
+            const auto& triangleVertices = outputMesh.triangles[triangle];
+            const std::array<Vertex, 3> v = {vertex(triangleVertices[0]), vertex(triangleVertices[1]),
+                                             vertex(triangleVertices[2])};
+
+            const double orientation = robustPredicates ?
+                                       GeometricPredicates::Filtered::orientation(v[0].data(), v[1].data(),
+                                                                                  v[2].data()) :
+                                       GeometricPredicates::Fast::orientation(v[0].data(), v[1].data(), v[2].data());
+            if (orientation >= 0) {
+                validation.report << "Triangle: " << v[0] << v[1] << v[2] << " is not clockwise." << std::endl;
+                validation.validTopology = false;
+            }
+
+            for (int edgeId = 0; edgeId < 3; ++edgeId) {
+                const TriangleIndex neighbor = triangleNeighbors[triangle][edgeId];
+                if (neighbor == Mesh::NO_TRIANGLE) {
+                    ++validation.numberOfBoundaryEdges;
+                    continue;
+                }
+
+                //  the neighbor has the edge in the opposite direction, therefore it starts from its second vertex
+                const auto& neighborVertices = outputMesh.triangles[neighbor];
+                const VertexIndex Pj = triangleVertices[(edgeId + 1) % 3];
+                const int neighborEdgeId = neighborVertices[0] == Pj ? 0 : neighborVertices[1] == Pj ? 1 : 2;
+                if (triangleNeighbors[neighbor][neighborEdgeId] != triangle) {
+                    validation.report << "Triangle: " << v[0] << v[1] << v[2] << " and its neighbor across edge "
+                                      << edgeId << " are not neighbors of each other." << std::endl;
+                    validation.validTopology = false;
+                    continue;
+                }
+
+                //  each interior edge is tested once
+                if (neighbor < triangle) {
+                    continue;
+                }
+
+                const Vertex opposite = vertex(neighborVertices[(neighborEdgeId + 2) % 3]);
+                const bool inCircle = robustPredicates ?
+                                      GeometricPredicates::Filtered::inCircle(v[0].data(), v[1].data(), v[2].data(),
+                                                                              opposite.data()) :
+                                      GeometricPredicates::Fast::inCircle(v[0].data(), v[1].data(), v[2].data(),
+                                                                          opposite.data());
+                if (inCircle) {
+                    validation.report << "Triangle: " << v[0] << v[1] << v[2] << " against Vertex: " << opposite
+                                      << " is not Delaunay." << std::endl;
+                    validation.validDelaunay = false;
+                }
+            }
+        }
+        GeometricPredicates::flushFilterStatistics();
+    };
+
+    const TriangleIndex numberOfRanges = std::clamp<TriangleIndex>(numberOfTriangles / MIN_TRIANGLES_PER_THREAD, 1,
+                                                                   std::max(numberOfThreads, 1u));
+    std::vector<RangeValidation> validations(numberOfRanges);
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfRanges - 1);
+    for (TriangleIndex range = 1; range < numberOfRanges; ++range) {
+        threads.emplace_back(validateRange, static_cast<TriangleIndex>(uint64_t(range) * numberOfTriangles /
+                                                                       numberOfRanges),
+                             static_cast<TriangleIndex>(uint64_t(range + 1) * numberOfTriangles / numberOfRanges),
+                             std::ref(validations[range]));
+    }
+    validateRange(0, numberOfTriangles / numberOfRanges, validations[0]);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    bool validDelaunay = true;
+    TriangleIndex numberOfBoundaryEdges = 0;
+    for (const auto& validation : validations) {
+        std::cout << validation.report.str();
+        validTopology = validTopology && validation.validTopology;
+        validDelaunay = validDelaunay && validation.validDelaunay;
+        numberOfBoundaryEdges += validation.numberOfBoundaryEdges;
+    }
+
+    //  a triangulated disk has Euler characteristic V - E + F = 1, where each interior edge is shared by two triangles
+    if (numberOfTriangles > 0) {
+        std::vector<bool> usedVertices(numberOfVertices, false);
+        for (const auto& triangle : outputMesh.triangles) {
+            for (const VertexIndex vertexIndex : triangle) {
+                usedVertices[vertexIndex] = true;
+            }
+        }
+        //  the local checks only cover the triangulated domain, therefore a vertex that no triangle uses is missing
+        for (VertexIndex vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+            if (!usedVertices[vertexIndex]) {
+                std::cout << "Vertex: " << vertex(vertexIndex) << " is not used by any triangle." << std::endl;
+                validTopology = false;
+            }
+        }
+
+        //  a mesh whose edges are locally Delaunay is Delaunay only if its domain is convex, therefore each boundary
+        //  vertex must not be reflex. The boundary edge PiPj of a clockwise triangle has the mesh on its right, and the
+        //  next boundary edge PjPk must not turn left.
+        constexpr VertexIndex NO_VERTEX = UINT32_MAX;
+        std::vector<VertexIndex> nextBoundaryVertex(numberOfVertices, NO_VERTEX);
+        for (TriangleIndex triangle = 0; triangle < numberOfTriangles; ++triangle) {
+            for (int edgeId = 0; edgeId < 3; ++edgeId) {
+                if (triangleNeighbors[triangle][edgeId] != Mesh::NO_TRIANGLE) {
+                    continue;
+                }
+
+                const VertexIndex Pi = outputMesh.triangles[triangle][edgeId];
+                if (nextBoundaryVertex[Pi] != NO_VERTEX) {
+                    std::cout << "Vertex: " << vertex(Pi) << " starts two boundary edges." << std::endl;
+                    validTopology = false;
+                }
+                nextBoundaryVertex[Pi] = outputMesh.triangles[triangle][(edgeId + 1) % 3];
+            }
+        }
+        for (VertexIndex Pi = 0; Pi < numberOfVertices; ++Pi) {
+            const VertexIndex Pj = nextBoundaryVertex[Pi];
+            if (Pj == NO_VERTEX) {
+                continue;
+            }
+            const VertexIndex Pk = nextBoundaryVertex[Pj];
+            if (Pk == NO_VERTEX) {
+                std::cout << "Vertex: " << vertex(Pj) << " ends a boundary edge but starts none." << std::endl;
+                validTopology = false;
+                continue;
+            }
+
+            const std::array<Vertex, 3> v = {vertex(Pi), vertex(Pj), vertex(Pk)};
+            const double orientation = robustPredicates ?
+                                       GeometricPredicates::Filtered::orientation(v[0].data(), v[1].data(),
+                                                                                  v[2].data()) :
+                                       GeometricPredicates::Fast::orientation(v[0].data(), v[1].data(), v[2].data());
+            if (orientation > 0) {
+                std::cout << "Boundary Vertex: " << v[1] << " is reflex, therefore the mesh does not cover the convex "
+                          << "hull of its vertices." << std::endl;
+                validDelaunay = false;
+            }
+        }
+
+        const auto V = static_cast<int64_t>(std::count(usedVertices.begin(), usedVertices.end(), true));
+        const auto E = (3 * static_cast<int64_t>(numberOfTriangles) + numberOfBoundaryEdges) / 2;
+        const auto F = static_cast<int64_t>(numberOfTriangles);
+        if (V - E + F != 1) {
+            std::cout << "Euler characteristic V - E + F = " << V << " - " << E << " + " << F << " = " << V - E + F
+                      << ", but a triangulated disk has 1." << std::endl;
+            validTopology = false;
+        }
+    }
+
+    if (!validTopology) {
+        std::cout << std::endl << "Triangulation is not valid" << std::endl;
+    } else if (!validDelaunay) {
+        std::cout << std::endl << "Triangulation is not Delaunay" << std::endl;
+    } else {
+        std::cout << std::endl << "Triangulation is Delaunay" << std::endl;
+    }
+
+    validateDelaunayTriangulationTimer.stopTimer();
+}
+
+const Mesh& Triangulation::getOutputMesh() const
+{
+    return outputMesh;
+}
@@ -8,6 +8,7 @@
  */
 
 #include <iostream>
+#include <random>
 #include "CLI11.hpp"
 #include "Args.hxx"
 
@@ -18,10 +19,22 @@ namespace Args
     // CLI Arguments
     ////////////////////////////////////////////
     std::string inputFileName;
+    std::string inputFormat = "auto";
     size_t numberOfRandomVertices = 0;
+    std::string randomDistribution = "uniform";
     bool robustPredicates = true;
+    std::string algorithm = "incremental";
+    unsigned numberOfThreads = 1;
+    bool compactMesh = false;
+    std::string pointLocation = "dag";
+    std::string insertionOrder = "random";
+    std::string duplicateRemoval = "sort";
+    uint64_t seed = 0;
     bool validateDelaunayProperty = false;
+    size_t numberOfLocateQueries = 0;
     std::string outputFileName;
+    std::string outputFormat = "text";
+    bool outputNeighbors = false;
     ////////////////////////////////////////////
 
     int parseArguments(int argc, char** argv)
@@ -39,33 +52,137 @@ namespace Args
         auto inputFileOption = app->add_option("-i,--input", inputFileName, "Input Vertices file to triangulate.\n")
                 ->check(CLI::ExistingFile);
 
+        app->add_option("--input-format", inputFormat,
+                        "Input format. 'node' reads a .node file, 'float64' and 'float32' read little-endian (x, y) "
+                        "pairs, raw or after a .dpts header, which are mapped in memory without parsing. 'auto' "
+                        "chooses 'float64' for .dpts, .xy and .f64 files, 'float32' for .f32 files, and 'node' "
+                        "otherwise.\n"
+                        "(Default: auto)\n")
+                ->check(CLI::IsMember({"auto", "node", "float64", "float32"}))
+                ->needs(inputFileOption);
+
         auto randomVerticesSetOption = app->add_option("-r, --random", numberOfRandomVertices,
-                                                       "Generates and uniformly random set of N 2D Vertices.\n")
+                                                       "Generates a random set of N 2D Vertices of the random "
+                                                       "distribution.\n")
                 ->check(CLI::PositiveNumber);
 
+        app->add_option("--random-distribution", randomDistribution,
+                        "Distribution of the random vertices. 'uniform' fills a square, 'gaussian-clusters' gathers "
+                        "them around a few random centers, 'circle' puts them on a circle, 'grid' takes the integer "
+                        "points of a square grid, 'kuzmin' concentrates them around the center of the square, and "
+                        "'line-segments' puts them on a few random segments.\n"
+                        "(Default: uniform)\n")
+                ->check(CLI::IsMember({"uniform", "gaussian-clusters", "circle", "grid", "kuzmin", "line-segments"}))
+                ->needs(randomVerticesSetOption);
+
         inputFileOption->excludes(randomVerticesSetOption);
         randomVerticesSetOption->excludes(inputFileOption);
 
-        //  ensure that input vertices will be provided or randomly produced
-        app->final_callback([]() {
-            if (numberOfRandomVertices == 0 && inputFileName.empty()) {
-                throw (CLI::ValidationError("Use either --input or --random options"));
-            }
-        });
-
         app->add_option("-p,--robust-predicates", robustPredicates,
                         "Uses Robust Predicates. '0' doesn't use Robust Predicates, '1' uses Robust Predicates.\n"
                         "(Default: 1)\n");
 
+        app->add_option("-a,--algorithm", algorithm,
+                        "Triangulation algorithm. 'incremental' inserts the vertices one by one, 'divide-and-conquer' "
+                        "merges the triangulations of the two halves of the sorted vertices recursively, 'sweep-hull' "
+                        "inserts the vertices one by one in a triangulation that grows from its convex hull, without a "
+                        "bounding triangle.\n"
+                        "(Default: incremental)\n")
+                ->check(CLI::IsMember({"incremental", "divide-and-conquer", "sweep-hull"}));
+
+        app->add_option("-t,--threads", numberOfThreads,
+                        "Number of threads used by the input parsing or generation, the sorting of the vertices, the "
+                        "divide-and-conquer algorithm, the validation, and the point location queries.\n"
+                        "(Default: 1)\n")
+                ->check(CLI::PositiveNumber);
+
+        auto compactMeshOption = app->add_flag("-c,--compact-mesh", compactMesh,
+                                               "Stores the mesh in contiguous arrays with 32-bit indices instead of "
+                                               "Vertex and Triangle objects. Incremental algorithm only.\n");
+
+        auto pointLocationOption = app->add_option("-l,--point-location", pointLocation,
+                                                   "Point location strategy. 'dag' descends the History DAG, 'walk' "
+                                                   "walks the current triangulation from the last created triangle "
+                                                   "and does not build the History DAG. Incremental algorithm "
+                                                   "only.\n"
+                                                   "(Default: dag)\n")
+                ->check(CLI::IsMember({"dag", "walk"}));
+
+        auto insertionOrderOption = app->add_option("--insertion-order", insertionOrder,
+                                                    "Insertion order of the vertices. 'random' inserts them in a "
+                                                    "random permutation, 'brio' inserts them in random rounds of "
+                                                    "doubling size, each sorted along the Hilbert curve. Incremental "
+                                                    "algorithm only.\n"
+                                                    "(Default: random)\n")
+                ->check(CLI::IsMember({"random", "brio"}));
+
+        app->add_option("--duplicate-removal", duplicateRemoval,
+                        "Duplicate removal of the input vertices. 'sort' removes the runs of equal vertices of the "
+                        "sorted vertices, 'hash' inserts the vertices in a hash set in expected linear time, which "
+                        "spares the sort of the incremental engines and remembers the surviving vertex of each "
+                        "duplicate.\n"
+                        "(Default: sort)\n")
+                ->check(CLI::IsMember({"sort", "hash"}));
+
+        auto seedOption = app->add_option("--seed", seed,
+                                          "Seed of the random input vertices, of the random insertion order, and of "
+                                          "the point location queries. The same input and seed give the same mesh "
+                                          "for any number of threads.\n"
+                                          "(Default: random)\n");
+
         app->add_flag("-d,--validate-delaunay", validateDelaunayProperty,
-                      "Validates the Delaunay Property of the triangulation.\n");
+                      "Validates the topology and the Delaunay Property of the triangulation in linear time.\n");
+
+        app->add_option("--locate-queries", numberOfLocateQueries,
+                        "Locates N uniformly random points of the bounding box of the mesh in its triangles, and "
+                        "reports the throughput of the queries.\n"
+                        "(Default: 0)\n");
 
         app->add_option("-o,--output", outputFileName,
                         "Output file that includes triangulation.\n")
                 ->required();
 
+        app->add_option("--output-format", outputFormat,
+                        "Output format. 'text' writes .node and .ele files, 'binary' writes a .dmesh file of "
+                        "little-endian arrays that can be mapped in memory without parsing.\n"
+                        "(Default: text)\n")
+                ->check(CLI::IsMember({"text", "binary"}));
+
+        auto outputNeighborsOption = app->add_flag("--output-neighbors", outputNeighbors,
+                                                   "Stores the neighbors of the triangles in the .dmesh file. "
+                                                   "Binary output format only.\n");
+
+        app->final_callback([=]() {
+            //  ensure that input vertices will be provided or randomly produced
+            if (numberOfRandomVertices == 0 && inputFileName.empty()) {
+                throw (CLI::ValidationError("Use either --input or --random options"));
+            }
+
+            //  the other algorithms neither build a mesh of objects, nor locate the vertices, nor shuffle them
+            if (algorithm != "incremental") {
+                for (const auto option : {compactMeshOption, pointLocationOption, insertionOrderOption}) {
+                    if (option->count() > 0) {
+                        throw (CLI::ValidationError(option->get_name(), "applies only to the incremental algorithm, "
+                                                                        "not to " + algorithm));
+                    }
+                }
+            }
+
+            //  the .node and .ele files have no room for the neighbors
+            if (outputFormat != "binary" && outputNeighborsOption->count() > 0) {
+                throw (CLI::ValidationError(outputNeighborsOption->get_name(), "applies only to the binary output "
+                                                                               "format, not to " + outputFormat));
+            }
+        });
+
         try {
             app->parse(argc, argv);
+
+            //  a random seed is displayed, so the run can be repeated
+            if (seedOption->count() == 0) {
+                std::random_device randomDevice;
+                seed = (uint64_t(randomDevice()) << 32u) | randomDevice();
+            }
         }
         catch (const CLI::CallForHelp& e) {
             std::cout << app->help();
@@ -104,12 +221,23 @@ namespace Args
 
         if (!inputFileName.empty()) {
             out << "Input vertices file: " << inputFileName << std::endl;;
+            out << "Input format: " << inputFormat << std::endl;
         } else {
-            out << "Number of random uniform vertices: " << numberOfRandomVertices << std::endl;
+            out << "Number of random vertices: " << numberOfRandomVertices << std::endl;
+            out << "Random distribution: " << randomDistribution << std::endl;
         }
         out << "Use Robust Predicates: " << yesNo(robustPredicates) << std::endl;
+        out << "Algorithm: " << algorithm << std::endl;
+        out << "Number of threads: " << numberOfThreads << std::endl;
+        out << "Use compact mesh: " << yesNo(compactMesh) << std::endl;
+        out << "Point location: " << pointLocation << std::endl;
+        out << "Insertion order: " << insertionOrder << std::endl;
+        out << "Duplicate removal: " << duplicateRemoval << std::endl;
+        out << "Seed: " << seed << std::endl;
         out << "Validate Delaunay property: " << yesNo(validateDelaunayProperty) << std::endl;
+        out << "Number of point location queries: " << numberOfLocateQueries << std::endl;
         out << "Output Mesh file: " << outputFileName << std::endl;;
+        out << "Output format: " << outputFormat << std::endl;
         out << SEPARATOR << std::endl;;
     }
 }
@@ -7,95 +7,741 @@
  * Created on   2/25/2020.
  */
 
-#include <cassert>
-#include <fstream>
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
 #include <iostream>
-#include <random>
+#include <memory>
+#include <thread>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "IO.hxx"
+#include "RandomGenerator.hxx"
 
 
 namespace Io
 {
-    bool hasComments(std::string& line)
+    //  chunks smaller than this are not worth a thread
+    constexpr size_t MIN_CHUNK_SIZE = 1 << 20;
+
+    //  the binary formats store the arrays as they are in memory
+    constexpr bool LITTLE_ENDIAN_HOST = __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+
+    //  side of the square of the random vertices
+    constexpr double RANDOM_SQUARE_SIZE = 1000000;
+    //  number of clusters or segments of the random vertices
+    constexpr size_t NUMBER_OF_RANDOM_SHAPES = 16;
+    //  standard deviation of the coordinates of a cluster
+    constexpr double GAUSSIAN_DEVIATION = RANDOM_SQUARE_SIZE / 100;
+    //  radius of the Kuzmin disk that holds 29% of its vertices
+    constexpr double KUZMIN_SCALE = RANDOM_SQUARE_SIZE / 100;
+    //  ranges smaller than this are not worth a thread
+    constexpr size_t MIN_RANDOM_VERTICES_PER_RANGE = 1 << 16;
+
+    /**
+     * @brief Maps a file in memory for reading. It exits if the file cannot be opened or mapped.
+     *
+     * @param filename is the file name
+     * @param fileSize is the size of the file
+     * @return the mapping of the file, or nullptr if the file is empty
+     */
+    static void* mapFile(const std::string& filename, size_t& fileSize)
     {
-        return line == "#" || line.empty();
+        const int fileDescriptor = open(filename.c_str(), O_RDONLY);
+        struct stat fileStatus{};
+        if (fileDescriptor < 0 || fstat(fileDescriptor, &fileStatus) != 0) {
+            std::cerr << "Could not open " << filename << " file" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        fileSize = static_cast<size_t>(fileStatus.st_size);
+        void* mapping = fileSize == 0 ? nullptr : mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        close(fileDescriptor);
+        if (mapping == MAP_FAILED) {
+            std::cerr << "Could not map " << filename << " file" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        return mapping;
     }
 
-    std::vector<Vertex> readInput(const std::string& filename)
+    /**
+     * @brief Skips the whitespace and the comments, which start with '#' and end at the end of the line.
+     *
+     * @param position is the current position in the text
+     * @param end is the end of the text
+     * @param stopAtNewline is true if the skipping stops at the end of the current line
+     * @return the position of the next token, or the end of the text or of the line
+     */
+    static const char* skipBlanks(const char* position, const char* end, bool stopAtNewline = false)
     {
-        std::cout << std::endl << "Reading Input file..." << std::endl;
+        while (position != end) {
+            if (*position == '#') {
+                position = static_cast<const char*>(std::memchr(position, '\n', end - position));
+                if (position == nullptr) {
+                    return end;
+                }
+            } else if (*position == '\n' ? stopAtNewline : !std::isspace(static_cast<unsigned char>(*position))) {
+                break;
+            } else {
+                ++position;
+            }
+        }
 
-        std::vector<Vertex> vertices;
+        return position;
+    }
 
-        std::ifstream inputFile;
-        inputFile.open(filename.c_str());
-
-        if (inputFile) {
-            size_t numberOfVertices = 0;
-            std::string line, restLine;
-
-            do {
-                inputFile >> line;
-                if (!hasComments(line)) {
-                    numberOfVertices = stoi(line);
-                    vertices.reserve(numberOfVertices);
-
-                    size_t numberOfDimensions, numberOfAttributes, boundaryMarker;
-                    inputFile >> numberOfDimensions >> numberOfAttributes >> boundaryMarker;
-                    if (numberOfDimensions != 2) {
-                        std::cerr << "The number of Dimensions must be 2\n";
-                    }
-                    assert(numberOfDimensions == 2);
-                }
-                std::getline(inputFile, restLine);
-            } while (hasComments(line));
-
-            do {
-                inputFile >> line;
-                if (!hasComments(line)) {
-                    //  defining the first vertex
-                    size_t vertexId = std::stoi(line);
-                    Vertex vertex;
-                    inputFile >> vertex[0] >> vertex[1];
-                    vertices.push_back(vertex);
-                    std::getline(inputFile, restLine);
-
-                    //  defining the rest of the vertices
-                    for (size_t i = 0; i < numberOfVertices - 1; i++) {
-                        inputFile >> vertexId >> vertex[0] >> vertex[1];
-                        vertices.push_back(vertex);
-                    }
+    /**
+     * @brief Parses a number, which may have a leading '+' unlike in std::from_chars.
+     *
+     * @tparam Number is the type of the number
+     * @param position is the position of the number, and it becomes the position after the number
+     * @param end is the end of the text
+     * @param number is the parsed number
+     * @return true if a number was parsed
+     */
+    template <typename Number>
+    static bool parseNumber(const char*& position, const char* end, Number& number)
+    {
+        if (position != end && *position == '+') {
+            ++position;
+        }
+
+        const auto [last, error] = std::from_chars(position, end, number);
+        if (error != std::errc() || (last != end && !std::isspace(static_cast<unsigned char>(*last)) &&
+                                     *last != '#')) {
+            return false;
+        }
+
+        position = last;
+        return true;
+    }
+
+    /**
+     * @brief Reports a malformed input file and exits.
+     *
+     * @param filename is the file name of the input file
+     * @param text is the text of the file
+     * @param position is the position of the error
+     * @param reason is the description of the error
+     */
+    [[noreturn]] static void reportMalformedInput(const std::string& filename, const char* text, const char* position,
+                                                  const char* reason)
+    {
+        const auto line = std::count(text, position, '\n') + 1;
+        std::cerr << "Malformed " << filename << " file at line " << line << ": " << reason << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    /**
+     * @brief The first error in a chunk of an input file.
+     */
+    struct ParseError
+    {
+        const char* position = nullptr;
+        const char* reason = nullptr;
+    };
+
+    /**
+     * @brief Parses the vertex lines of a chunk of a .node file, which starts at the beginning of a line.
+     * Each line holds <vertex #> <x> <y> [attributes] [boundary marker], and the vertex number, the attributes, and
+     * the boundary marker are skipped.
+     *
+     * @param position is the beginning of the chunk
+     * @param end is the end of the chunk
+     * @param vertices are the vertices parsed before the first error
+     * @return the first error of the chunk, whose position is nullptr if there is none
+     */
+    static ParseError parseVertexLines(const char* position, const char* end, std::vector<Vertex>& vertices)
+    {
+        while (true) {
+            position = skipBlanks(position, end, true);
+            if (position == end) {
+                return {};
+            } else if (*position == '\n') {
+                ++position;
+                continue;
+            }
+
+            //  the output files number the mesh vertices again, therefore the vertex number is not kept
+            while (position != end && !std::isspace(static_cast<unsigned char>(*position))) {
+                ++position;
+            }
+
+            Vertex vertex;
+            position = skipBlanks(position, end, true);
+            if (!parseNumber(position, end, vertex[0])) {
+                return {position, "invalid x coordinate"};
+            }
+            position = skipBlanks(position, end, true);
+            if (!parseNumber(position, end, vertex[1])) {
+                return {position, "invalid y coordinate"};
+            }
+            vertices.push_back(vertex);
+
+            position = static_cast<const char*>(std::memchr(position, '\n', end - position));
+            if (position == nullptr) {
+                return {};
+            }
+        }
+    }
+
+    /**
+     * @brief Parses a .node file mapped in memory. Its vertex lines are parsed in parallel chunks.
+     *
+     * @param filename is the file name of the .node file
+     * @param text is the beginning of the file
+     * @param end is the end of the file
+     * @param numberOfThreads is the number of threads that parse the file
+     * @return the vertices in the order of the file
+     */
+    static std::vector<Vertex> readNodeVertices(const std::string& filename, const char* text, const char* end,
+                                                unsigned numberOfThreads)
+    {
+        if (text == end) {
+            reportMalformedInput(filename, nullptr, nullptr, "missing number of vertices");
+        }
+
+        //  header: <# of vertices> <dimension (must be 2)> [<# of attributes> [<# of boundary markers (0 or 1)>]]
+        const char* position = skipBlanks(text, end);
+        std::array<size_t, 4> header = {0, 2, 0, 0};
+        for (size_t i = 0; i < header.size(); ++i) {
+            position = skipBlanks(position, end, i > 0);
+            if (position == end || *position == '\n') {
+                if (i == 0) {
+                    reportMalformedInput(filename, text, position, "missing number of vertices");
                 }
-                std::getline(inputFile, restLine);
-            } while (hasComments(line));
+                break;
+            }
+            if (!parseNumber(position, end, header[i])) {
+                reportMalformedInput(filename, text, position, "invalid header");
+            }
+        }
+
+        //  the attributes and the boundary markers are skipped with the rest of each vertex line
+        const size_t numberOfVertices = header[0];
+        if (header[1] != 2) {
+            reportMalformedInput(filename, text, position, "the number of dimensions must be 2");
+        }
+
+        //  the vertex lines are split in chunks at line boundaries, which are parsed in parallel
+        const char* lines = static_cast<const char*>(std::memchr(position, '\n', end - position));
+        lines = lines == nullptr ? end : lines + 1;
+        const auto linesSize = static_cast<size_t>(end - lines);
+        const size_t numberOfChunks = std::clamp<size_t>(linesSize / MIN_CHUNK_SIZE, 1, numberOfThreads);
+
+        std::vector<const char*> chunkBoundaries(numberOfChunks + 1, end);
+        chunkBoundaries[0] = lines;
+        for (size_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+            const char* boundary = std::max(lines + chunk * linesSize / numberOfChunks, chunkBoundaries[chunk - 1]);
+            boundary = static_cast<const char*>(std::memchr(boundary, '\n', end - boundary));
+            chunkBoundaries[chunk] = boundary == nullptr ? end : boundary + 1;
+        }
+
+        std::vector<std::vector<Vertex>> chunkVertices(numberOfChunks);
+        std::vector<ParseError> chunkErrors(numberOfChunks);
+        const auto parseChunk = [&](size_t chunk) {
+            chunkVertices[chunk].reserve(numberOfVertices / numberOfChunks + 1);
+            chunkErrors[chunk] = parseVertexLines(chunkBoundaries[chunk], chunkBoundaries[chunk + 1],
+                                                  chunkVertices[chunk]);
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(numberOfChunks - 1);
+        for (size_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+            threads.emplace_back(parseChunk, chunk);
+        }
+        parseChunk(0);
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        //  the chunks are merged in the order of the file, and the lines after the declared vertices are ignored
+        std::vector<Vertex> vertices;
+        vertices.reserve(numberOfVertices);
+        for (size_t chunk = 0; chunk < numberOfChunks && vertices.size() < numberOfVertices; ++chunk) {
+            const size_t count = std::min(chunkVertices[chunk].size(), numberOfVertices - vertices.size());
+            vertices.insert(vertices.end(), chunkVertices[chunk].begin(), chunkVertices[chunk].begin() + count);
+            chunkVertices[chunk] = std::vector<Vertex>();
+
+            if (vertices.size() < numberOfVertices && chunkErrors[chunk].position != nullptr) {
+                reportMalformedInput(filename, text, chunkErrors[chunk].position, chunkErrors[chunk].reason);
+            }
+        }
+        if (vertices.size() < numberOfVertices) {
+            reportMalformedInput(filename, text, end, "fewer vertices than declared in the header");
+        }
+
+        return vertices;
+    }
+
+    /**
+     * @brief Converts the (x, y) pairs of a binary point cloud mapped in memory in parallel ranges.
+     *
+     * @tparam Coordinate is the type of the coordinates of the file, double or float
+     * @param pairs are the coordinates of the vertices in the mapping, which may be unaligned
+     * @param numberOfVertices is the number of vertices
+     * @param numberOfThreads is the number of threads that convert the vertices
+     * @return the vertices in the order of the file
+     */
+    template <typename Coordinate>
+    static std::vector<Vertex> convertBinaryVertices(const char* pairs, size_t numberOfVertices,
+                                                     unsigned numberOfThreads)
+    {
+        std::vector<Vertex> vertices(numberOfVertices);
+
+        const auto convertRange = [&](size_t first, size_t last) {
+            std::array<Coordinate, 2> pair{};
+            for (size_t i = first; i < last; ++i) {
+                std::memcpy(pair.data(), pairs + i * sizeof(pair), sizeof(pair));
+                vertices[i][0] = pair[0];
+                vertices[i][1] = pair[1];
+            }
+        };
+
+        const size_t bytes = numberOfVertices * 2 * sizeof(Coordinate);
+        const size_t numberOfRanges = std::clamp<size_t>(bytes / MIN_CHUNK_SIZE, 1, numberOfThreads);
+
+        std::vector<std::thread> threads;
+        threads.reserve(numberOfRanges - 1);
+        for (size_t range = 1; range < numberOfRanges; ++range) {
+            threads.emplace_back(convertRange, range * numberOfVertices / numberOfRanges,
+                                 (range + 1) * numberOfVertices / numberOfRanges);
+        }
+        convertRange(0, numberOfVertices / numberOfRanges);
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        return vertices;
+    }
+
+    /**
+     * @brief Reads a binary point cloud mapped in memory, raw or after a BinaryPointsHeader.
+     *
+     * @param filename is the file name of the binary point cloud
+     * @param data is the beginning of the file
+     * @param fileSize is the size of the file
+     * @param numberOfThreads is the number of threads that convert the vertices
+     * @param inputFormat is the format of the raw pairs, Float64 or Float32, which a header overrides
+     * @return the vertices in the order of the file
+     */
+    static std::vector<Vertex> readBinaryVertices(const std::string& filename, const char* data, size_t fileSize,
+                                                  unsigned numberOfThreads, InputFormat inputFormat)
+    {
+        if (!LITTLE_ENDIAN_HOST) {
+            std::cerr << "The binary input formats require a little-endian host" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        size_t bytesPerCoordinate = inputFormat == InputFormat::Float32 ? sizeof(float) : sizeof(double);
+        size_t verticesOffset = 0;
+        size_t numberOfVertices = 0;
+
+        BinaryPointsHeader header{};
+        if (fileSize >= sizeof(header)) {
+            std::memcpy(&header, data, sizeof(header));
+        }
+
+        if (header.magic == BinaryPointsHeader::MAGIC) {
+            bytesPerCoordinate = header.bytesPerCoordinate;
+            verticesOffset = header.verticesOffset;
+            numberOfVertices = header.numberOfVertices;
+
+            const bool valid = header.version == BinaryPointsHeader::VERSION &&
+                               (bytesPerCoordinate == sizeof(double) || bytesPerCoordinate == sizeof(float)) &&
+                               verticesOffset >= sizeof(header) && verticesOffset <= fileSize &&
+                               numberOfVertices <= (fileSize - verticesOffset) / (2 * bytesPerCoordinate);
+            if (!valid) {
+                std::cerr << filename << " is not a valid version " << BinaryPointsHeader::VERSION
+                          << " binary point cloud" << std::endl;
+                exit(EXIT_FAILURE);
+            }
         } else {
-            std::cerr << "Could not open " << filename << " file" << std::endl;
+            if (fileSize % (2 * bytesPerCoordinate) != 0) {
+                std::cerr << "Malformed " << filename << " file: its size is not a multiple of "
+                          << 2 * bytesPerCoordinate << " bytes, the size of an (x, y) pair" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            numberOfVertices = fileSize / (2 * bytesPerCoordinate);
+        }
+
+        if (numberOfVertices == 0) {
+            std::cerr << "Malformed " << filename << " file: it has no vertices" << std::endl;
             exit(EXIT_FAILURE);
         }
 
+        if (bytesPerCoordinate == sizeof(float)) {
+            return convertBinaryVertices<float>(data + verticesOffset, numberOfVertices, numberOfThreads);
+        }
+        return convertBinaryVertices<double>(data + verticesOffset, numberOfVertices, numberOfThreads);
+    }
+
+    /**
+     * @brief Chooses the input format of a file by its extension.
+     *
+     * @param filename is the file name of the input file
+     * @return Float64 for .dpts, .xy and .f64 files, Float32 for .f32 files, and Node otherwise
+     */
+    static InputFormat detectInputFormat(const std::string& filename)
+    {
+        const size_t lastDot = filename.find_last_of('.');
+        const std::string extension = lastDot == std::string::npos ? "" : filename.substr(lastDot);
+
+        if (extension == ".dpts" || extension == ".xy" || extension == ".f64") {
+            return InputFormat::Float64;
+        } else if (extension == ".f32") {
+            return InputFormat::Float32;
+        }
+        return InputFormat::Node;
+    }
+
+    std::vector<Vertex> readInput(const std::string& filename, unsigned numberOfThreads, InputFormat inputFormat)
+    {
+        std::cout << std::endl << "Reading Input file..." << std::endl;
+
+        if (inputFormat == InputFormat::Automatic) {
+            inputFormat = detectInputFormat(filename);
+        }
+
+        //  the file is mapped and read in place, without copying it into stream buffers and strings
+        size_t fileSize = 0;
+        void* const mapping = mapFile(filename, fileSize);
+        madvise(mapping, fileSize, MADV_SEQUENTIAL);
+
+        const char* const data = static_cast<const char*>(mapping);
+        std::vector<Vertex> vertices = inputFormat == InputFormat::Node ?
+                                       readNodeVertices(filename, data, data + fileSize, numberOfThreads) :
+                                       readBinaryVertices(filename, data, fileSize, numberOfThreads, inputFormat);
+
+        if (mapping != nullptr) {
+            munmap(mapping, fileSize);
+        }
+
         return vertices;
     }
 
-    std::vector<Vertex> generateUniformRandomInput(const size_t& numberOfRandomVertices)
+    /**
+     * @brief Generates the i-th random vertex of a distribution, which draws a fixed amount of random numbers.
+     *
+     * @param randomDistribution is the distribution of the vertices
+     * @param randomGenerator is the generator, at the counter of the vertex
+     * @param i is the index of the vertex
+     * @param shapes are the centers of the clusters or the endpoints of the segments
+     * @param gridSide is the number of columns of the grid
+     * @return the coordinates of the vertex
+     */
+    static std::array<double, 2> generateRandomVertex(RandomDistribution randomDistribution,
+                                                      RandomGenerator& randomGenerator, size_t i,
+                                                      const std::vector<std::array<double, 4>>& shapes,
+                                                      size_t gridSide)
+    {
+        constexpr double TWO_PI = 6.283185307179586476925;
+        constexpr double CENTER = RANDOM_SQUARE_SIZE / 2;
+
+        switch (randomDistribution) {
+            case RandomDistribution::GaussianClusters: {
+                const auto& center = shapes[static_cast<size_t>(shapes.size() * randomGenerator.uniformReal())];
+                //  Box-Muller transform, whose two normal numbers are the two offsets from the center
+                const double radius = GAUSSIAN_DEVIATION * std::sqrt(-2 * std::log(1 - randomGenerator.uniformReal()));
+                const double angle = TWO_PI * randomGenerator.uniformReal();
+                return {center[0] + radius * std::cos(angle), center[1] + radius * std::sin(angle)};
+            }
+            case RandomDistribution::Circle: {
+                const double angle = TWO_PI * randomGenerator.uniformReal();
+                return {CENTER + CENTER * std::cos(angle), CENTER + CENTER * std::sin(angle)};
+            }
+            case RandomDistribution::Grid:
+                return {static_cast<double>(i % gridSide), static_cast<double>(i / gridSide)};
+            case RandomDistribution::Kuzmin: {
+                //  inverse of the mass 1 - 1 / sqrt(1 + r^2) of the disk within radius r
+                const double mass = randomGenerator.uniformReal();
+                const double radius = KUZMIN_SCALE * std::sqrt(1 / ((1 - mass) * (1 - mass)) - 1);
+                const double angle = TWO_PI * randomGenerator.uniformReal();
+                return {CENTER + radius * std::cos(angle), CENTER + radius * std::sin(angle)};
+            }
+            case RandomDistribution::LineSegments: {
+                const auto& segment = shapes[static_cast<size_t>(shapes.size() * randomGenerator.uniformReal())];
+                const double t = randomGenerator.uniformReal();
+                return {segment[0] + t * (segment[2] - segment[0]), segment[1] + t * (segment[3] - segment[1])};
+            }
+            default:
+                return {RANDOM_SQUARE_SIZE * randomGenerator.uniformReal(),
+                        RANDOM_SQUARE_SIZE * randomGenerator.uniformReal()};
+        }
+    }
+
+    std::vector<Vertex> generateRandomInput(const size_t& numberOfRandomVertices, uint64_t seed,
+                                            RandomDistribution randomDistribution, unsigned numberOfThreads)
     {
 
-        std::cout << std::endl << "Generating " << numberOfRandomVertices << " uniformly random vertices..."
-                  << std::endl;
+        std::cout << std::endl << "Generating " << numberOfRandomVertices << " random vertices..." << std::endl;
 
-        std::default_random_engine randomGenerator(std::random_device{}());
-        std::uniform_real_distribution<double> distributionX(0, 1000000);
-        std::uniform_real_distribution<double> distributionY(0, 1000000);
+        //  the shapes of the clusters and the segments are drawn from their own stream
+        RandomGenerator shapesGenerator(seed, RandomStream::InputShapes);
+        std::vector<std::array<double, 4>> shapes(NUMBER_OF_RANDOM_SHAPES);
+        for (auto& shape : shapes) {
+            for (auto& coordinate : shape) {
+                coordinate = RANDOM_SQUARE_SIZE * shapesGenerator.uniformReal();
+            }
+        }
 
-        std::vector<Vertex> vertices;
-        vertices.reserve(numberOfRandomVertices);
-        for (size_t i = 0; i < numberOfRandomVertices; ++i) {
-            vertices.push_back(Vertex({distributionX(randomGenerator), distributionY(randomGenerator)}));
+        auto gridSide = static_cast<size_t>(std::sqrt(static_cast<double>(numberOfRandomVertices)));
+        while (gridSide * gridSide < numberOfRandomVertices) {
+            ++gridSide;
+        }
+
+        //  the random numbers of each vertex, so that a range starts at the counter of its first vertex
+        uint64_t numbersPerVertex = 2;
+        if (randomDistribution == RandomDistribution::GaussianClusters) {
+            numbersPerVertex = 3;
+        } else if (randomDistribution == RandomDistribution::Circle) {
+            numbersPerVertex = 1;
+        } else if (randomDistribution == RandomDistribution::Grid) {
+            numbersPerVertex = 0;
+        }
+
+        std::vector<Vertex> vertices(numberOfRandomVertices);
+
+        const auto generateRange = [&](size_t first, size_t last) {
+            RandomGenerator randomGenerator(seed, RandomStream::InputVertices, numbersPerVertex * first);
+            for (size_t i = first; i < last; ++i) {
+                const std::array<double, 2> coordinates = generateRandomVertex(randomDistribution, randomGenerator, i,
+                                                                               shapes, gridSide);
+                vertices[i][0] = coordinates[0];
+                vertices[i][1] = coordinates[1];
+            }
+        };
+
+        const size_t numberOfRanges = std::clamp<size_t>(numberOfRandomVertices / MIN_RANDOM_VERTICES_PER_RANGE, 1,
+                                                         numberOfThreads);
+
+        std::vector<std::thread> threads;
+        threads.reserve(numberOfRanges - 1);
+        for (size_t range = 1; range < numberOfRanges; ++range) {
+            threads.emplace_back(generateRange, range * numberOfRandomVertices / numberOfRanges,
+                                 (range + 1) * numberOfRandomVertices / numberOfRanges);
+        }
+        generateRange(0, numberOfRandomVertices / numberOfRanges);
+
+        for (auto& thread : threads) {
+            thread.join();
         }
 
         return vertices;
     }
 
-    void printMesh(const Mesh& mesh, const std::string& filename)
+    /**
+     * @brief Formats text into a large buffer, which is written to a file with one system call when it is full.
+     */
+    class BufferedWriter
+    {
+    public:
+        //  the longest line of the output files, three integers or an integer and two shortest round-trip doubles
+        static constexpr size_t MAX_LINE_SIZE = 128;
+
+        /**
+         * @brief Constructor of BufferedWriter. It exits if the file cannot be opened.
+         *
+         * @param filename is the file name of the output file
+         */
+        explicit BufferedWriter(const std::string& filename)
+                : filename(filename), buffer(std::make_unique<char[]>(BUFFER_SIZE))
+        {
+            fileDescriptor = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fileDescriptor < 0) {
+                std::cerr << "Could not open " << filename << " file" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        /**
+         * @brief Destructor of BufferedWriter. It writes the rest of the buffer and closes the file.
+         */
+        ~BufferedWriter()
+        {
+            flush();
+            close(fileDescriptor);
+        }
+
+        /**
+         * @brief Makes room for a line, writing the buffer to the file if needed.
+         */
+        void reserveLine()
+        {
+            if (BUFFER_SIZE - size < MAX_LINE_SIZE) {
+                flush();
+            }
+        }
+
+        /**
+         * @brief Appends a number, which is formatted by std::to_chars. Doubles get their shortest round-trip form.
+         * A line must be reserved first.
+         *
+         * @param number is the number
+         * @param separator is the character after the number
+         */
+        template <typename Number>
+        void append(Number number, char separator)
+        {
+            //  the separator always fits after the number
+            char* const last = std::to_chars(&buffer[size], &buffer[BUFFER_SIZE - 1], number).ptr;
+            *last = separator;
+            size = static_cast<size_t>(last - &buffer[0]) + 1;
+        }
+
+        /**
+         * @brief Writes the buffer to the file. It exits if the file cannot be written.
+         */
+        void flush()
+        {
+            writeBytes(&buffer[0], size);
+            size = 0;
+        }
+
+        /**
+         * @brief Writes raw bytes after the buffer, without copying them into it.
+         *
+         * @param bytes are the bytes
+         * @param numberOfBytes is the number of bytes
+         */
+        void appendBytes(const void* bytes, size_t numberOfBytes)
+        {
+            flush();
+            writeBytes(static_cast<const char*>(bytes), numberOfBytes);
+        }
+
+    private:
+        /**
+         * @brief Writes bytes to the file. It exits if the file cannot be written.
+         *
+         * @param bytes are the bytes
+         * @param numberOfBytes is the number of bytes
+         */
+        void writeBytes(const char* bytes, size_t numberOfBytes)
+        {
+            for (size_t written = 0; written < numberOfBytes;) {
+                const ssize_t result = ::write(fileDescriptor, bytes + written, numberOfBytes - written);
+                if (result < 0) {
+                    std::cerr << "Could not write " << filename << " file" << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                written += static_cast<size_t>(result);
+            }
+        }
+
+        static constexpr size_t BUFFER_SIZE = 1 << 22;
+
+        const std::string& filename;
+        int fileDescriptor;
+        std::unique_ptr<char[]> buffer;
+        size_t size = 0;
+    };
+
+    /**
+     * @brief Writes the vertices of a mesh in a .node file.
+     *
+     * @param mesh is the mesh
+     * @param filename is the file name of the .node file
+     */
+    static void printVertices(const Mesh& mesh, const std::string& filename)
+    {
+        BufferedWriter writer(filename);
+
+        writer.reserveLine();
+        writer.append(mesh.verticesX.size(), ' ');
+        writer.append(2, ' ');
+        writer.append(0, ' ');
+        writer.append(0, '\n');
+
+        for (size_t i = 0; i < mesh.verticesX.size(); i++) {
+            writer.reserveLine();
+            writer.append(i + 1, ' ');
+            writer.append(mesh.verticesX[i], ' ');
+            writer.append(mesh.verticesY[i], '\n');
+        }
+    }
+
+    /**
+     * @brief Writes the triangles of a mesh in a .ele file.
+     *
+     * @param mesh is the mesh
+     * @param filename is the file name of the .ele file
+     */
+    static void printTriangles(const Mesh& mesh, const std::string& filename)
+    {
+        BufferedWriter writer(filename);
+
+        writer.reserveLine();
+        writer.append(mesh.triangles.size(), ' ');
+        writer.append(3, ' ');
+        writer.append(0, '\n');
+
+        for (size_t i = 0; i < mesh.triangles.size(); i++) {
+            writer.reserveLine();
+            writer.append(i + 1, ' ');
+            writer.append(mesh.triangles[i][0] + 1, ' ');
+            writer.append(mesh.triangles[i][1] + 1, ' ');
+            writer.append(mesh.triangles[i][2] + 1, '\n');
+        }
+    }
+
+    /**
+     * @brief Rounds an offset of a .dmesh file up to a multiple of 8.
+     */
+    static uint64_t alignOffset(uint64_t offset)
+    {
+        return (offset + 7) & ~uint64_t(7);
+    }
+
+    /**
+     * @brief Writes a mesh in a .dmesh file.
+     *
+     * @param mesh is the mesh
+     * @param filename is the file name of the .dmesh file
+     * @param outputNeighbors is true if the neighbors of the triangles are stored
+     */
+    static void printBinaryMesh(const Mesh& mesh, const std::string& filename, bool outputNeighbors)
+    {
+        if (!LITTLE_ENDIAN_HOST) {
+            std::cerr << "The binary output format requires a little-endian host" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        BinaryMeshHeader header{};
+        header.magic = BinaryMeshHeader::MAGIC;
+        header.version = BinaryMeshHeader::VERSION;
+        header.hasNeighbors = outputNeighbors ? 1 : 0;
+        header.numberOfVertices = mesh.verticesX.size();
+        header.numberOfTriangles = mesh.triangles.size();
+        header.verticesXOffset = sizeof(BinaryMeshHeader);
+        header.verticesYOffset = header.verticesXOffset + header.numberOfVertices * sizeof(double);
+        header.trianglesOffset = header.verticesYOffset + header.numberOfVertices * sizeof(double);
+        header.neighborsOffset = outputNeighbors ? alignOffset(header.trianglesOffset + header.numberOfTriangles *
+                                                                                     sizeof(mesh.triangles[0])) : 0;
+
+        BufferedWriter writer(filename);
+        writer.appendBytes(&header, sizeof(header));
+        writer.appendBytes(mesh.verticesX.data(), mesh.verticesX.size() * sizeof(double));
+        writer.appendBytes(mesh.verticesY.data(), mesh.verticesY.size() * sizeof(double));
+        writer.appendBytes(mesh.triangles.data(), mesh.triangles.size() * sizeof(mesh.triangles[0]));
+        if (outputNeighbors) {
+            const std::array<char, 8> padding{};
+            writer.appendBytes(padding.data(), header.neighborsOffset - header.trianglesOffset -
+                                               header.numberOfTriangles * sizeof(mesh.triangles[0]));
+
+            const std::vector<std::array<TriangleIndex, 3>> triangleNeighbors = mesh.computeTriangleNeighbors();
+            writer.appendBytes(triangleNeighbors.data(), triangleNeighbors.size() * sizeof(triangleNeighbors[0]));
+        }
+    }
+
+    void printMesh(const Mesh& mesh, const std::string& filename, OutputFormat outputFormat, bool outputNeighbors)
     {
         std::cout << std::endl << "Printing mesh... " << std::endl;
 
@@ -106,48 +752,97 @@ namespace Io
         } else {
             rawFilename = filename.substr(0, lastdot);
         }
+
+        if (outputFormat == OutputFormat::Binary) {
+            std::string meshFilename = rawFilename + ".dmesh";
+            printBinaryMesh(mesh, meshFilename, outputNeighbors);
+
+            std::cout << std::endl << "Mesh is stored in: " << meshFilename << std::endl;
+            return;
+        }
+
         std::string verticesFilename = rawFilename + ".node";
         std::string trianglesFilename = rawFilename + ".ele";
 
-        //  vertices
-        std::ofstream verticesOutputFile;
-        verticesOutputFile.open(verticesFilename.c_str());
+        //  the two files are formatted and written in parallel
+        std::thread verticesThread(printVertices, std::cref(mesh), std::cref(verticesFilename));
+        printTriangles(mesh, trianglesFilename);
+        verticesThread.join();
 
-        if (verticesOutputFile) {
-            verticesOutputFile << mesh.vertices.size() << " 2 0 0" << std::endl;
+        std::cout << std::endl << "Vertices are stored in: " << verticesFilename << std::endl;
+        std::cout << "Triangles are stored in: " << trianglesFilename << std::endl;
+    }
 
-            //  print vertices
-            for (size_t i = 0; i < mesh.vertices.size(); i++) {
-                verticesOutputFile << i + 1 << " " << mesh.vertices[i][0] << " " << mesh.vertices[i][1]
-                                   << std::endl;
-            }
-        } else {
-            std::cerr << "Could not open " << verticesFilename << " file" << std::endl;
+    MappedMesh::MappedMesh(const std::string& filename) : fileSize(0)
+    {
+        if (!LITTLE_ENDIAN_HOST) {
+            std::cerr << "The binary mesh format requires a little-endian host" << std::endl;
             exit(EXIT_FAILURE);
         }
-        verticesOutputFile.close();
 
-        std::cout << std::endl << "Vertices are stored in: " << verticesFilename << std::endl;
+        mapping = mapFile(filename, fileSize);
+        header = static_cast<const BinaryMeshHeader*>(mapping);
 
-        //  triangles
-        std::ofstream trianglesOutputFile;
-        trianglesOutputFile.open(trianglesFilename.c_str());
+        //  the arrays must lie in the file, at aligned offsets
+        const auto validArray = [this](uint64_t offset, uint64_t count, uint64_t size) {
+            return offset % 8 == 0 && offset >= sizeof(BinaryMeshHeader) && offset <= fileSize &&
+                   count <= (fileSize - offset) / size;
+        };
 
-        if (trianglesOutputFile) {
-            trianglesOutputFile << mesh.triangles.size() << " 3 0" << std::endl;
-
-            //  print triangles
-            for (size_t i = 0; i < mesh.triangles.size(); i++) {
-                trianglesOutputFile << i + 1 << " " << mesh.triangles[i]->vertices[0]->id << " "
-                                    << mesh.triangles[i]->vertices[1]->id
-                                    << " " << mesh.triangles[i]->vertices[2]->id << std::endl;
-            }
-        } else {
-            std::cerr << "Could not open " << trianglesFilename << " file" << std::endl;
+        const bool valid = fileSize >= sizeof(BinaryMeshHeader) && header->magic == BinaryMeshHeader::MAGIC &&
+                           header->version == BinaryMeshHeader::VERSION &&
+                           validArray(header->verticesXOffset, header->numberOfVertices, sizeof(double)) &&
+                           validArray(header->verticesYOffset, header->numberOfVertices, sizeof(double)) &&
+                           validArray(header->trianglesOffset, header->numberOfTriangles,
+                                      sizeof(std::array<VertexIndex, 3>)) &&
+                           (header->hasNeighbors == 0 ||
+                            validArray(header->neighborsOffset, header->numberOfTriangles,
+                                       sizeof(std::array<TriangleIndex, 3>)));
+        if (!valid) {
+            std::cerr << filename << " is not a valid version " << BinaryMeshHeader::VERSION << " .dmesh file"
+                      << std::endl;
             exit(EXIT_FAILURE);
         }
-        trianglesOutputFile.close();
+    }
 
-        std::cout << "Triangles are stored in: " << trianglesFilename << std::endl;
+    MappedMesh::~MappedMesh()
+    {
+        munmap(mapping, fileSize);
+    }
+
+    size_t MappedMesh::getNumberOfVertices() const
+    {
+        return header->numberOfVertices;
+    }
+
+    size_t MappedMesh::getNumberOfTriangles() const
+    {
+        return header->numberOfTriangles;
+    }
+
+    const double* MappedMesh::getVerticesX() const
+    {
+        return reinterpret_cast<const double*>(static_cast<const char*>(mapping) + header->verticesXOffset);
+    }
+
+    const double* MappedMesh::getVerticesY() const
+    {
+        return reinterpret_cast<const double*>(static_cast<const char*>(mapping) + header->verticesYOffset);
+    }
+
+    const std::array<VertexIndex, 3>* MappedMesh::getTriangles() const
+    {
+        return reinterpret_cast<const std::array<VertexIndex, 3>*>(static_cast<const char*>(mapping) +
+                                                                   header->trianglesOffset);
+    }
+
+    const std::array<TriangleIndex, 3>* MappedMesh::getTriangleNeighbors() const
+    {
+        if (header->hasNeighbors == 0) {
+            return nullptr;
+        }
+
+        return reinterpret_cast<const std::array<TriangleIndex, 3>*>(static_cast<const char*>(mapping) +
+                                                                     header->neighborsOffset);
     }
 }
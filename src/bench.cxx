@@ -0,0 +1,428 @@
+/*
+ * Filename:    bench.cxx
+ *
+ * Description: File that contains the microbenchmarks of Del-O-Matic.
+ *
+ * Author:      Spiros Tsalikis
+ * Created on   10/17/26.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <benchmark/benchmark.h>
+#include "CompactDelaunayTriangulation.hxx"
+#include "DelaunayTriangulation.hxx"
+#include "DivideAndConquerTriangulation.hxx"
+#include "GeometricPredicates.hxx"
+#include "HistoryDAG.hxx"
+#include "IO.hxx"
+#include "RandomGenerator.hxx"
+#include "SweepHullTriangulation.hxx"
+
+
+//  the seed of every random input, so that the runs of a benchmark measure the same work
+constexpr uint64_t BENCHMARK_SEED = 1;
+
+//  the predicates cycle over this many inputs, which fit in the L1 cache
+constexpr size_t NUMBER_OF_PREDICATE_INPUTS = 1024;
+
+//  the number of vertices of the I/O benchmarks
+constexpr size_t NUMBER_OF_IO_VERTICES = 1 << 20;
+
+/**
+ * @brief Generates the inputs of the predicates: clockwise triangles and tested vertices, which are uniformly random,
+ * or nearly degenerate so that the filter of the robust predicates cannot decide them.
+ *
+ * @param degenerate is true if the tested vertices lie on an edge or on the circumcircle of their triangle
+ * @param onCircle is true if the vertices of the triangles and the tested vertices lie on a common circle
+ * @return the coordinates of the three vertices of each triangle, followed by the coordinates of its tested vertex
+ */
+static std::vector<std::array<double, 8>> generatePredicateInputs(bool degenerate, bool onCircle)
+{
+    constexpr double TWO_PI = 6.283185307179586476925;
+
+    RandomGenerator randomGenerator(BENCHMARK_SEED, RandomStream::InputVertices);
+
+    std::vector<std::array<double, 8>> inputs(NUMBER_OF_PREDICATE_INPUTS);
+    for (auto& input : inputs) {
+        if (onCircle) {
+            //  the angles decrease by less than a quarter of the circle, therefore the triangle is clockwise
+            double angle = TWO_PI * randomGenerator.uniformReal();
+            for (size_t i = 0; i < 4; ++i) {
+                input[2 * i] = std::cos(angle);
+                input[2 * i + 1] = std::sin(angle);
+                angle -= (TWO_PI / 4) * (0.5 + randomGenerator.uniformReal() / 2);
+            }
+        } else {
+            for (auto& coordinate : input) {
+                coordinate = randomGenerator.uniformReal();
+            }
+            if (GeometricPredicates::Fast::orientation(&input[0], &input[2], &input[4]) > 0) {
+                std::swap(input[0], input[2]);
+                std::swap(input[1], input[3]);
+            }
+        }
+
+        if (degenerate && !onCircle) {
+            //  a point of the first edge, which is collinear with it up to rounding
+            const double t = randomGenerator.uniformReal();
+            input[6] = input[0] + t * (input[2] - input[0]);
+            input[7] = input[1] + t * (input[3] - input[1]);
+        }
+    }
+
+    return inputs;
+}
+
+/**
+ * @brief Benchmarks GeometricPredicates::inTriangle.
+ *
+ * @tparam Predicates is the predicate policy
+ * @param state is the state of the benchmark, whose argument is 1 for tested vertices on an edge of their triangle
+ */
+template <typename Predicates>
+static void benchmarkInTriangle(benchmark::State& state)
+{
+    const std::vector<std::array<double, 8>> inputs = generatePredicateInputs(state.range(0) != 0, false);
+
+    std::array<double, 3> orientationTests{};
+    size_t numberOfInside = 0;
+    for (auto _ : state) {
+        for (const auto& input : inputs) {
+            numberOfInside += GeometricPredicates::inTriangle<Predicates>(&input[0], &input[2], &input[4], &input[6],
+                                                                          orientationTests);
+        }
+        benchmark::DoNotOptimize(numberOfInside);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * inputs.size()));
+}
+
+/**
+ * @brief Benchmarks the inCircle predicate.
+ *
+ * @tparam Predicates is the predicate policy
+ * @param state is the state of the benchmark, whose argument is 1 for cocircular vertices
+ */
+template <typename Predicates>
+static void benchmarkInCircle(benchmark::State& state)
+{
+    const std::vector<std::array<double, 8>> inputs = generatePredicateInputs(false, state.range(0) != 0);
+
+    size_t numberOfInside = 0;
+    for (auto _ : state) {
+        for (const auto& input : inputs) {
+            numberOfInside += Predicates::inCircle(&input[0], &input[2], &input[4], &input[6]);
+        }
+        benchmark::DoNotOptimize(numberOfInside);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * inputs.size()));
+}
+
+/**
+ * @brief Benchmarks HistoryDAG::locateTriangle on the DAG of a triangulation that splits its triangles at uniformly
+ * random vertices, inserted in random order, without the flips of the Delaunay Triangulation.
+ *
+ * @tparam Predicates is the predicate policy
+ * @param state is the state of the benchmark, whose argument is the number of vertices of the DAG
+ */
+template <typename Predicates>
+static void benchmarkLocateTriangle(benchmark::State& state)
+{
+    const auto numberOfVertices = static_cast<size_t>(state.range(0));
+
+    //  the vertices and the triangles are referenced by the DAG, therefore they are never moved
+    std::vector<Vertex> vertices = Io::generateRandomInput(numberOfVertices + NUMBER_OF_PREDICATE_INPUTS,
+                                                           BENCHMARK_SEED);
+    for (auto& vertex : vertices) {
+        vertex[0] /= 1000000;
+        vertex[1] /= 1000000;
+    }
+    vertices.push_back(Vertex({-100, -100}));
+    vertices.push_back(Vertex({0.5, 100}));
+    vertices.push_back(Vertex({100, -100}));
+    std::deque<Triangle> triangles;
+
+    HistoryDAG historyDAG;
+    historyDAG.reserve(numberOfVertices);
+
+    const auto addTriangle = [&](VertexHandle Pi, VertexHandle Pj, VertexHandle Pk) {
+        Triangle& triangle = triangles.emplace_back(std::array<VertexHandle, 3>{Pi, Pj, Pk});
+        triangle.dagNode = historyDAG.addTriangle(&triangle);
+        return &triangle;
+    };
+
+    //  the bounding triangle is the last three vertices, which are clockwise
+    addTriangle(&vertices[vertices.size() - 3], &vertices[vertices.size() - 2], &vertices[vertices.size() - 1]);
+
+    std::array<double, 3> orientationTests{};
+    for (size_t i = 0; i < numberOfVertices; ++i) {
+        const VertexHandle Pr = &vertices[i];
+        const TriangleHandle PiPjPk = historyDAG.locateTriangle<Predicates>(Pr, orientationTests);
+
+        //  a vertex on an edge would split two triangles, it is skipped instead
+        if (orientationTests[0] != 0 && orientationTests[1] != 0 && orientationTests[2] != 0) {
+            const auto& [Pi, Pj, Pk] = PiPjPk->vertices;
+            historyDAG.addChildTriangles(PiPjPk, {addTriangle(Pi, Pj, Pr), addTriangle(Pj, Pk, Pr),
+                                                  addTriangle(Pk, Pi, Pr)});
+        }
+    }
+
+    //  the queries are the vertices that were not inserted
+    size_t query = numberOfVertices;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(historyDAG.locateTriangle<Predicates>(&vertices[query], orientationTests));
+        if (++query == numberOfVertices + NUMBER_OF_PREDICATE_INPUTS) {
+            query = numberOfVertices;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief Benchmarks the flip throughput of legalizeEdge in the incremental algorithm. The vertices are inserted in BRIO
+ * order and located by walks, which take a few steps, so that most of the time is spent in the splits and the flips.
+ * The rate is the number of flips divided by the time of the whole generateMesh, therefore it includes the walks and
+ * the splits.
+ *
+ * @param state is the state of the benchmark, whose argument is the number of vertices
+ */
+static void benchmarkLegalizeEdge(benchmark::State& state)
+{
+    const std::vector<Vertex> vertices = Io::generateRandomInput(static_cast<size_t>(state.range(0)),
+                                                                 BENCHMARK_SEED);
+
+    uint64_t numberOfFlips = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<Vertex> inputVertices = vertices;
+        DelaunayTriangulation<GeometricPredicates::Filtered> triangulation(PointLocation::Walk, InsertionOrder::BRIO);
+        triangulation.setInputVertices(inputVertices);
+        state.ResumeTiming();
+
+        triangulation.generateMesh();
+
+        numberOfFlips += triangulation.getNumberOfFlips();
+    }
+
+    state.counters["flips"] = benchmark::Counter(static_cast<double>(numberOfFlips), benchmark::Counter::kIsRate);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Benchmarks Io::readInput.
+ *
+ * @param state is the state of the benchmark, whose argument is 0 for a .node file and 1 for a float64 point cloud
+ */
+static void benchmarkReadInput(benchmark::State& state)
+{
+    const std::vector<Vertex> vertices = Io::generateRandomInput(NUMBER_OF_IO_VERTICES, BENCHMARK_SEED);
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+
+    std::string filename;
+    if (state.range(0) == 0) {
+        //  a mesh without triangles writes the vertices as a .node file
+        Mesh mesh;
+        for (const auto& vertex : vertices) {
+            mesh.verticesX.push_back(vertex[0]);
+            mesh.verticesY.push_back(vertex[1]);
+        }
+        Io::printMesh(mesh, (directory / "delomatic_bench_input").string());
+        std::filesystem::remove(directory / "delomatic_bench_input.ele");
+        filename = (directory / "delomatic_bench_input.node").string();
+    } else {
+        filename = (directory / "delomatic_bench_input.xy").string();
+        FILE* file = std::fopen(filename.c_str(), "wb");
+        for (const auto& vertex : vertices) {
+            std::fwrite(vertex.data(), sizeof(double), 2, file);
+        }
+        std::fclose(file);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Io::readInput(filename).data());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * std::filesystem::file_size(filename)));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUMBER_OF_IO_VERTICES));
+    std::filesystem::remove(filename);
+}
+
+/**
+ * @brief Benchmarks Io::printMesh.
+ *
+ * @param state is the state of the benchmark, whose argument is 0 for the text format and 1 for the binary format
+ */
+static void benchmarkPrintMesh(benchmark::State& state)
+{
+    std::vector<Vertex> vertices = Io::generateRandomInput(NUMBER_OF_IO_VERTICES, BENCHMARK_SEED);
+    SweepHullTriangulation<GeometricPredicates::Filtered> triangulation;
+    triangulation.setInputVertices(vertices);
+    triangulation.generateMesh();
+
+    const Io::OutputFormat outputFormat = state.range(0) == 0 ? Io::OutputFormat::Text : Io::OutputFormat::Binary;
+    const std::filesystem::path filename = std::filesystem::temp_directory_path() / "delomatic_bench_output";
+
+    for (auto _ : state) {
+        Io::printMesh(triangulation.getOutputMesh(), filename.string(), outputFormat);
+    }
+
+    std::vector<std::filesystem::path> files = {filename.string() + ".dmesh"};
+    if (outputFormat == Io::OutputFormat::Text) {
+        files = {filename.string() + ".node", filename.string() + ".ele"};
+    }
+
+    int64_t bytes = 0;
+    for (const auto& file : files) {
+        bytes += static_cast<int64_t>(std::filesystem::file_size(file));
+        std::filesystem::remove(file);
+    }
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+/**
+ * @brief Creates a triangulation engine.
+ *
+ * @param algorithm is the name of the engine, as the --algorithm option of delomatic, or 'compact' for the compact
+ * incremental engine
+ * @return the triangulation engine, which uses the robust predicates and one thread
+ */
+static std::unique_ptr<Triangulation> createTriangulation(const std::string& algorithm)
+{
+    using Predicates = GeometricPredicates::Filtered;
+
+    if (algorithm == "divide-and-conquer") {
+        return std::make_unique<DivideAndConquerTriangulation<Predicates>>(1);
+    } else if (algorithm == "sweep-hull") {
+        return std::make_unique<SweepHullTriangulation<Predicates>>();
+    } else if (algorithm == "compact") {
+        return std::make_unique<CompactDelaunayTriangulation<Predicates>>(PointLocation::HistoryDAG,
+                                                                          InsertionOrder::Random);
+    } else {
+        return std::make_unique<DelaunayTriangulation<Predicates>>(PointLocation::HistoryDAG, InsertionOrder::Random);
+    }
+}
+
+/**
+ * @brief Benchmarks the preprocessing of the input vertices and the generation of the mesh.
+ *
+ * @param state is the state of the benchmark
+ * @param algorithm is the name of the engine
+ * @param randomDistribution is the distribution of the random vertices
+ * @param numberOfVertices is the number of random vertices
+ */
+static void benchmarkGenerateMesh(benchmark::State& state, const std::string& algorithm,
+                                  Io::RandomDistribution randomDistribution, size_t numberOfVertices)
+{
+    const std::vector<Vertex> vertices = Io::generateRandomInput(numberOfVertices, BENCHMARK_SEED,
+                                                                 randomDistribution);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<Vertex> inputVertices = vertices;
+        std::unique_ptr<Triangulation> triangulation = createTriangulation(algorithm);
+        triangulation->setSeed(BENCHMARK_SEED);
+        state.ResumeTiming();
+
+        triangulation->setInputVertices(inputVertices);
+        triangulation->generateMesh();
+
+        state.PauseTiming();
+        triangulation.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numberOfVertices));
+}
+
+BENCHMARK_TEMPLATE(benchmarkInTriangle, GeometricPredicates::Fast)->Name("InTriangle/fast")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(benchmarkInTriangle, GeometricPredicates::Filtered)->Name("InTriangle/robust")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(benchmarkInCircle, GeometricPredicates::Fast)->Name("InCircle/fast")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(benchmarkInCircle, GeometricPredicates::Filtered)->Name("InCircle/robust")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(benchmarkLocateTriangle, GeometricPredicates::Fast)->Name("LocateTriangle/fast")
+        ->RangeMultiplier(100)->Range(10000, 1000000);
+BENCHMARK_TEMPLATE(benchmarkLocateTriangle, GeometricPredicates::Filtered)->Name("LocateTriangle/robust")
+        ->RangeMultiplier(100)->Range(10000, 1000000);
+BENCHMARK(benchmarkLegalizeEdge)->Name("LegalizeEdge")->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+//  the files are written by a second thread and read from the page cache, therefore the wall time is measured
+BENCHMARK(benchmarkReadInput)->Name("ReadInput")->ArgName("float64")->Arg(0)->Arg(1)
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(benchmarkPrintMesh)->Name("PrintMesh")->ArgName("binary")->Arg(0)->Arg(1)
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+ * @brief Registers the end-to-end benchmarks of every engine: uniformly random vertices of several sizes, and 10^5
+ * vertices of every other distribution.
+ */
+static void registerGenerateMeshBenchmarks()
+{
+    const std::vector<std::pair<std::string, Io::RandomDistribution>> distributions = {
+            {"uniform",           Io::RandomDistribution::Uniform},
+            {"gaussian-clusters", Io::RandomDistribution::GaussianClusters},
+            {"circle",            Io::RandomDistribution::Circle},
+            {"grid",              Io::RandomDistribution::Grid},
+            {"kuzmin",            Io::RandomDistribution::Kuzmin},
+            {"line-segments",     Io::RandomDistribution::LineSegments}};
+
+    for (const std::string algorithm : {"incremental", "compact", "divide-and-conquer", "sweep-hull"}) {
+        for (const auto& [name, randomDistribution] : distributions) {
+            std::vector<size_t> sizes = {100000};
+            if (randomDistribution == Io::RandomDistribution::Uniform) {
+                sizes = {10000, 100000, 1000000};
+            }
+
+            for (const size_t numberOfVertices : sizes) {
+                benchmark::RegisterBenchmark(
+                        ("GenerateMesh/" + algorithm + "/" + name + "/" + std::to_string(numberOfVertices)).c_str(),
+                        benchmarkGenerateMesh, algorithm, randomDistribution, numberOfVertices)
+                        ->Unit(benchmark::kMillisecond);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    GeometricPredicates::initialize();
+    registerGenerateMeshBenchmarks();
+
+    //  the results are written as JSON, unless another output file is given
+    std::vector<char*> arguments(argv, argv + argc);
+    std::string outputArgument = "--benchmark_out=delomatic_bench.json";
+    std::string outputFormatArgument = "--benchmark_out_format=json";
+    bool hasOutput = false;
+    for (int i = 1; i < argc; ++i) {
+        hasOutput = hasOutput || std::strncmp(argv[i], "--benchmark_out=", 16) == 0;
+    }
+    if (!hasOutput) {
+        arguments.push_back(outputArgument.data());
+        arguments.push_back(outputFormatArgument.data());
+    }
+    int numberOfArguments = static_cast<int>(arguments.size());
+
+    benchmark::Initialize(&numberOfArguments, arguments.data());
+    if (benchmark::ReportUnrecognizedArguments(numberOfArguments, arguments.data())) {
+        return EXIT_FAILURE;
+    }
+
+    //  the engines and the I/O report their progress to std::cout, which is silenced while the benchmarks run
+    std::ostream console(std::cout.rdbuf());
+    std::cout.rdbuf(nullptr);
+
+    benchmark::ConsoleReporter consoleReporter;
+    consoleReporter.SetOutputStream(&console);
+    consoleReporter.SetErrorStream(&std::cerr);
+    benchmark::RunSpecifiedBenchmarks(&consoleReporter);
+    benchmark::Shutdown();
+
+    std::cout.rdbuf(console.rdbuf());
+
+    return EXIT_SUCCESS;
+}
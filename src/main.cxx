@@ -7,14 +7,83 @@
  * Created on   02/26/20.
  */
 
-#include <sys/resource.h>
+#include <algorithm>
 #include <bits/unique_ptr.h>
 #include <iostream>
 #include "Args.hxx"
+#include "CompactDelaunayTriangulation.hxx"
 #include "DelaunayTriangulation.hxx"
+#include "DivideAndConquerTriangulation.hxx"
+#include "GeometricPredicates.hxx"
 #include "IO.hxx"
+#include "MemoryUsage.hxx"
+#include "PointLocator.hxx"
+#include "RandomGenerator.hxx"
+#include "SweepHullTriangulation.hxx"
 
 
+/**
+ * @brief Creates the triangulation engine that is selected by the CLI arguments.
+ *
+ * @tparam Predicates is the predicate policy of the engine
+ * @param pointLocation is the point location strategy of the incremental engines
+ * @param insertionOrder is the insertion order of the incremental engines
+ * @return the triangulation engine
+ */
+template <typename Predicates>
+std::unique_ptr<Triangulation> createTriangulation(PointLocation pointLocation, InsertionOrder insertionOrder)
+{
+    if (Args::algorithm == "divide-and-conquer") {
+        return std::make_unique<DivideAndConquerTriangulation<Predicates>>(Args::numberOfThreads);
+    } else if (Args::algorithm == "sweep-hull") {
+        return std::make_unique<SweepHullTriangulation<Predicates>>();
+    } else if (Args::compactMesh) {
+        return std::make_unique<CompactDelaunayTriangulation<Predicates>>(pointLocation, insertionOrder);
+    } else {
+        return std::make_unique<DelaunayTriangulation<Predicates>>(pointLocation, insertionOrder);
+    }
+}
+
+/**
+ * @brief Locates uniformly random points of the bounding box of a mesh in its triangles.
+ *
+ * @tparam Predicates is the predicate policy of the locator
+ * @param mesh is the mesh
+ * @param numberOfQueries is the number of random points
+ * @param buildingLocatorTimer is the timer of the construction of the locator
+ * @param locatingTimer is the timer of the queries
+ * @return the number of points that lie in the mesh
+ */
+template <typename Predicates>
+size_t locateRandomQueries(const Mesh& mesh, size_t numberOfQueries, Timer& buildingLocatorTimer,
+                           Timer& locatingTimer)
+{
+    std::cout << std::endl << "Locating " << numberOfQueries << " uniformly random points..." << std::endl;
+
+    const auto [minX, maxX] = std::minmax_element(mesh.verticesX.begin(), mesh.verticesX.end());
+    const auto [minY, maxY] = std::minmax_element(mesh.verticesY.begin(), mesh.verticesY.end());
+
+    RandomGenerator randomGenerator(Args::seed, RandomStream::LocateQueries);
+
+    std::vector<Vertex> queries;
+    queries.reserve(numberOfQueries);
+    for (size_t i = 0; i < numberOfQueries; ++i) {
+        const double x = *minX + (*maxX - *minX) * randomGenerator.uniformReal();
+        const double y = *minY + (*maxY - *minY) * randomGenerator.uniformReal();
+        queries.push_back(Vertex({x, y}));
+    }
+
+    buildingLocatorTimer.startTimer();
+    const PointLocator<Predicates> pointLocator(mesh);
+    buildingLocatorTimer.stopTimer();
+
+    locatingTimer.startTimer();
+    const std::vector<TriangleIndex> triangles = pointLocator.locate(queries, Args::numberOfThreads);
+    locatingTimer.stopTimer();
+
+    return queries.size() - std::count(triangles.begin(), triangles.end(), PointLocator<Predicates>::NO_TRIANGLE);
+}
+
 int main(int argc, char** argv)
 {
     //  Parse CLI arguments
@@ -32,33 +101,101 @@ int main(int argc, char** argv)
 
     std::vector<Vertex> inputVertices;
     if (!Args::inputFileName.empty()) {
-        inputVertices = Io::readInput(Args::inputFileName);
+        Io::InputFormat inputFormat = Io::InputFormat::Automatic;
+        if (Args::inputFormat == "node") {
+            inputFormat = Io::InputFormat::Node;
+        } else if (Args::inputFormat == "float64") {
+            inputFormat = Io::InputFormat::Float64;
+        } else if (Args::inputFormat == "float32") {
+            inputFormat = Io::InputFormat::Float32;
+        }
+        inputVertices = Io::readInput(Args::inputFileName, Args::numberOfThreads, inputFormat);
     } else {
-        inputVertices = Io::generateUniformRandomInput(Args::numberOfRandomVertices);
+        Io::RandomDistribution randomDistribution = Io::RandomDistribution::Uniform;
+        if (Args::randomDistribution == "gaussian-clusters") {
+            randomDistribution = Io::RandomDistribution::GaussianClusters;
+        } else if (Args::randomDistribution == "circle") {
+            randomDistribution = Io::RandomDistribution::Circle;
+        } else if (Args::randomDistribution == "grid") {
+            randomDistribution = Io::RandomDistribution::Grid;
+        } else if (Args::randomDistribution == "kuzmin") {
+            randomDistribution = Io::RandomDistribution::Kuzmin;
+        } else if (Args::randomDistribution == "line-segments") {
+            randomDistribution = Io::RandomDistribution::LineSegments;
+        }
+        inputVertices = Io::generateRandomInput(Args::numberOfRandomVertices, Args::seed, randomDistribution,
+                                                Args::numberOfThreads);
     }
 
     readingInputTimer.stopTimer();
 
-    std::unique_ptr<DelaunayTriangulation> triangulation =
-            std::make_unique<DelaunayTriangulation>(Args::robustPredicates);
+    //  resident set size after each phase
+    const double readingInputMemory = MemoryUsage::getCurrentResidentSetSize();
+
+    PointLocation pointLocation = Args::pointLocation == "walk" ? PointLocation::Walk : PointLocation::HistoryDAG;
+    InsertionOrder insertionOrder = Args::insertionOrder == "brio" ? InsertionOrder::BRIO : InsertionOrder::Random;
+
+    std::unique_ptr<Triangulation> triangulation;
+    if (Args::robustPredicates) {
+        triangulation = createTriangulation<GeometricPredicates::Filtered>(pointLocation, insertionOrder);
+    } else {
+        triangulation = createTriangulation<GeometricPredicates::Fast>(pointLocation, insertionOrder);
+    }
+
+    triangulation->setDuplicateRemoval(Args::duplicateRemoval == "hash" ? DuplicateRemoval::Hash :
+                                       DuplicateRemoval::Sort);
+
+    triangulation->setSeed(Args::seed);
+
+    Timer preprocessingInputTimer{};
+    preprocessingInputTimer.startTimer();
+
+    triangulation->setInputVertices(inputVertices, Args::numberOfThreads);
+
+    preprocessingInputTimer.stopTimer();
+
+    //  the triangulation keeps its own copy of the vertices
+    inputVertices = std::vector<Vertex>();
 
-    triangulation->setInputVertices(inputVertices);
+    const double preprocessingMemory = MemoryUsage::getCurrentResidentSetSize();
 
     triangulation->generateMesh();
 
+    const double meshingMemory = MemoryUsage::getCurrentResidentSetSize();
+    const GeometricPredicates::FilterStatistics filterStatistics = GeometricPredicates::getFilterStatistics();
+
+    double validationMemory = 0;
     if (Args::validateDelaunayProperty) {
-        triangulation->validateDelaunayTriangulation();
+        triangulation->validateDelaunayTriangulation(Args::numberOfThreads);
+
+        validationMemory = MemoryUsage::getCurrentResidentSetSize();
     }
 
-    Mesh outputMesh = triangulation->getOutputMesh();
+    const Mesh& outputMesh = triangulation->getOutputMesh();
+
+    Timer buildingLocatorTimer{}, locatingTimer{};
+    size_t numberOfQueriesInMesh = 0;
+    if (Args::numberOfLocateQueries > 0 && !outputMesh.verticesX.empty()) {
+        if (Args::robustPredicates) {
+            numberOfQueriesInMesh = locateRandomQueries<GeometricPredicates::Filtered>(
+                    outputMesh, Args::numberOfLocateQueries, buildingLocatorTimer, locatingTimer);
+        } else {
+            numberOfQueriesInMesh = locateRandomQueries<GeometricPredicates::Fast>(
+                    outputMesh, Args::numberOfLocateQueries, buildingLocatorTimer, locatingTimer);
+        }
+    }
 
     Timer writingMeshTimer{};
     writingMeshTimer.startTimer();
 
-    Io::printMesh(outputMesh, Args::outputFileName);
+    const Io::OutputFormat outputFormat = Args::outputFormat == "binary" ? Io::OutputFormat::Binary :
+                                          Io::OutputFormat::Text;
+    Io::printMesh(outputMesh, Args::outputFileName, outputFormat, Args::outputNeighbors);
 
     writingMeshTimer.stopTimer();
 
+    const double writingMeshMemory = MemoryUsage::getCurrentResidentSetSize();
+
     //  print timers
     timer.stopTimer();
 
@@ -67,9 +204,10 @@ int main(int argc, char** argv)
     if (!Args::inputFileName.empty()) {
         std::cout << "Reading Input I/O time: " << readingInputTimer.getSeconds() << " seconds" << std::endl;
     } else {
-        std::cout << "Generating uniformly random Input time: " << readingInputTimer.getSeconds() << " seconds"
+        std::cout << "Generating random Input time: " << readingInputTimer.getSeconds() << " seconds"
                   << std::endl;
     }
+    std::cout << "Preprocessing Input time: " << preprocessingInputTimer.getSeconds() << " seconds" << std::endl;
     std::cout << "Computing Boundary Triangle time: "
               << triangulation->computeBoundaryTriangleTimer.getSeconds() << " seconds" << std::endl;
     std::cout << "Meshing time: " << triangulation->meshingTimer.getSeconds() << " seconds" << std::endl;
@@ -77,19 +215,51 @@ int main(int argc, char** argv)
         std::cout << "Validating Delaunay Property time: "
                   << triangulation->validateDelaunayTriangulationTimer.getSeconds() << " seconds" << std::endl;
     }
+    if (Args::numberOfLocateQueries > 0) {
+        std::cout << "Building Point Locator time: " << buildingLocatorTimer.getSeconds() << " seconds" << std::endl;
+        std::cout << "Locating Queries time: " << locatingTimer.getSeconds() << " seconds ("
+                  << static_cast<double>(Args::numberOfLocateQueries) / locatingTimer.getSeconds()
+                  << " queries per second, " << numberOfQueriesInMesh << " in the mesh)" << std::endl;
+    }
     std::cout << "Writing Mesh I/O time: " << writingMeshTimer.getSeconds() << " seconds" << std::endl;
     std::cout << std::endl << "Execution Wall time: " << timer.getSeconds() << " seconds" << std::endl;
     std::cout << "================================================" << std::endl;
 
+    //  print the share of the predicates that were decided by the floating-point filter
+    if (Args::robustPredicates) {
+        const auto percentage = [](uint64_t fallbacks, uint64_t tests) {
+            return tests == 0 ? 100.0 : 100.0 * static_cast<double>(tests - fallbacks) / static_cast<double>(tests);
+        };
+
+        std::cout << std::endl << "Del-O-Matic Filtered Predicates" << std::endl;
+        std::cout << "================================================" << std::endl;
+        std::cout << "Orientation tests: " << filterStatistics.orientationTests << ", decided by the filter: "
+                  << percentage(filterStatistics.orientationFallbacks, filterStatistics.orientationTests) << "%"
+                  << std::endl;
+        std::cout << "InCircle tests: " << filterStatistics.inCircleTests << ", decided by the filter: "
+                  << percentage(filterStatistics.inCircleFallbacks, filterStatistics.inCircleTests) << "%"
+                  << std::endl;
+        std::cout << "================================================" << std::endl;
+    }
+
     //  print memory used
-    struct rusage usage{};
-    int usageResult = getrusage(RUSAGE_SELF, &usage);
-    if (usageResult != 0) {
-        std::cerr << std::endl << "Failed to get memory usage information" << std::endl;
+    std::cout << std::endl << "Del-O-Matic Resident Memory" << std::endl;
+    std::cout << "================================================" << std::endl;
+    if (!Args::inputFileName.empty()) {
+        std::cout << "After Reading Input I/O: " << readingInputMemory << " MB" << std::endl;
     } else {
-        std::cout << std::endl << "Main reports " << static_cast<double>(usage.ru_maxrss) / 1024.0
-                  << " MB of memory used" << std::endl;
+        std::cout << "After Generating random Input: " << readingInputMemory << " MB" << std::endl;
+    }
+    std::cout << "After Preprocessing Input: " << preprocessingMemory << " MB" << std::endl;
+    std::cout << "After Meshing: " << meshingMemory << " MB" << std::endl;
+    if (Args::validateDelaunayProperty) {
+        std::cout << "After Validating Delaunay Property: " << validationMemory << " MB" << std::endl;
     }
+    std::cout << "After Writing Mesh I/O: " << writingMeshMemory << " MB" << std::endl;
+    std::cout << "================================================" << std::endl;
+
+    std::cout << std::endl << "Main reports " << MemoryUsage::getPeakResidentSetSize() << " MB of memory used"
+              << std::endl;
 
     std::cout << std::endl << "PROGRAM FINISHED NORMALLY" << std::endl << std::endl;
 